@@ -9,9 +9,29 @@
 /** @brief Use C++17 std::from_char() and std::to_char() for string to/from numeric types conversion. 
  *         These are the most efficient standard functions. 
  *         Disable only if your compiler does not support them or if the induced memory footprint is too big.
+ *         The custom conversion of decimals uses a 5kBytes table of powers of 5 and strtod()/strtof() for rare values.
  */
 #define NANOJSONCPP_USE_CPP17_FROM_CHARS_TO_CHARS
 
+/** @brief Use a 256 bytes lookup table to classify the chars of the json string during parsing instead of comparisons :
+ *         speeds up parsing but increases ROM consumption
+ */
+#define NANOJSONCPP_USE_CHAR_CLASS_TABLE
+
+/** @brief Use SSE2 instructions to search the end of strings 16 chars at a time while parsing instead of testing the chars one by one,
+ *         and classify the json string by blocks of 64 bytes using SSE2/AVX2 instructions (AVX2 selected at runtime) to skip the
+ *         objects/arrays with json_cursor.
+ *         Speeds up parsing on x86-64 CPUs, mostly for long strings and skipped values, fallback to portable code on other CPUs
+ *         where it is slower and increases code size.
+ */
+/* #undef NANOJSONCPP_USE_SIMD_SCAN */
+
+/** @brief Check that the strings of the json string are valid UTF-8 sequences during parsing and store in the descriptor of each string value
+ *         if it only contains ASCII chars : slows down parsing of strings containing non ASCII chars and increases RAM memory
+ *         consumption of json_value_desc when json_size_t is 16 bits
+ */
+/* #undef NANOJSONCPP_USE_UTF8_VALIDATION */
+
 /** @brief Data type to store the size of json value as one of the following types :
  *         uint16_t => max json string size = 65535 bytes
  *         uint32_t => max json string size ~4GBytes
@@ -30,4 +50,20 @@
  */
 #define NANOJSONCPP_FLOAT_T double
 
+/** @brief Store the number of nested values of each object/array in its descriptor :
+ *         allow to go through an object/array in a time proportional to its number of members/elements
+ *         instead of its number of nested values, but increases RAM memory consumption of json_value_desc
+ */
+/* #undef NANOJSONCPP_USE_SUBTREE_SIZE */
+
+/** @brief Store a hash of the name of each object member in its descriptor :
+ *         speeds up the lookup of object members by their name but increases RAM memory consumption of json_value_desc
+ */
+/* #undef NANOJSONCPP_USE_NAME_HASH */
+
+/** @brief Maximum nesting level of objects/arrays in a json string [1;255] :
+ *         the parser keeps track of the opened objects/arrays using sizeof(json_size_t) bytes of stack per level
+ */
+#define NANOJSONCPP_MAX_NESTING_LEVEL 255
+
 #endif // NANOJSONCPP_CFG_H
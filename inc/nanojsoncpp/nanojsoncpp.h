@@ -12,6 +12,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <functional>
+#include <iterator>
 #include <limits>
 #include <optional>
 #include <string_view>
@@ -35,7 +36,16 @@ namespace nanojsoncpp
 constexpr json_size_t MAX_JSON_STRING_SIZE = std::numeric_limits<json_size_t>::max();
 
 /** @brief Maximum nesting level of objects and arrays in a json string */
-constexpr uint8_t MAX_NESTING_LEVEL = std::numeric_limits<uint8_t>::max();
+constexpr uint8_t MAX_NESTING_LEVEL = NANOJSONCPP_MAX_NESTING_LEVEL;
+
+/** @brief Maximum number of paths in a json_path_filter */
+constexpr size_t MAX_FILTER_PATHS = 64u;
+
+/** @brief Maximum number of components of a path in a json_path_filter */
+constexpr uint8_t MAX_FILTER_PATH_DEPTH = 16u;
+
+/** @brief Maximum size in bytes of a path in a json_path_filter */
+constexpr size_t MAX_FILTER_PATH_SIZE = 255u;
 
 /** @brief Json value type */
 enum class json_value_type : uint8_t
@@ -53,7 +63,9 @@ enum class json_value_type : uint8_t
     /** @brief Array */
     array,
     /** @brief Object */
-    object
+    object,
+    /** @brief Object or array beyond the maximum depth of a depth limited parsing, see json_value::expand() */
+    unexpanded
 };
 
 /** @brief Json value descriptor */
@@ -63,6 +75,10 @@ struct json_value_desc
     uint8_t nesting_level;
     /** @brief Type of the json value */
     json_value_type type;
+#ifdef NANOJSONCPP_USE_UTF8_VALIDATION
+    /** @brief Indicate if a string value only contains ASCII chars, undefined for other values */
+    bool ascii;
+#endif // NANOJSONCPP_USE_UTF8_VALIDATION
     /** @brief Index of the begining of the name of the value in the json string */
     json_size_t name_start;
     /** @brief Size of the name of the value in bytes in the json string */
@@ -71,16 +87,86 @@ struct json_value_desc
     json_size_t value_start;
     /** @brief Size of the value in bytes in the json string */
     json_size_t value_size;
+#ifdef NANOJSONCPP_USE_SUBTREE_SIZE
+    /** @brief Number of nested values (all levels) of an object/array, 0 for other types */
+    json_size_t subtree_size;
+#endif // NANOJSONCPP_USE_SUBTREE_SIZE
+#ifdef NANOJSONCPP_USE_NAME_HASH
+    /** @brief Hash of the name of an object member (truncated to json_size_t), undefined for other values */
+    json_size_t name_hash;
+#endif // NANOJSONCPP_USE_NAME_HASH
+};
+
+/** @brief Binary value of an integer or decimal value converted during parsing, see parse() with a numbers array */
+union json_number
+{
+    /** @brief Value of an integer value */
+    json_int_t integer;
+    /** @brief Value of a decimal value */
+    json_float_t decimal;
+};
+
+/** @brief Name of an object member with its precomputed hash, to be used for repeated lookups */
+class json_key
+{
+  public:
+    /** @brief Constructor */
+    constexpr json_key(const std::string_view& name) : m_name(name), m_hash(hash_name(name)) { }
+
+    /** @brief Get the name */
+    constexpr const std::string_view& name() const { return m_name; }
+
+    /** @brief Get the hash of the name */
+    constexpr uint32_t hash() const { return m_hash; }
+
+  private:
+    /** @brief Name */
+    std::string_view m_name;
+    /** @brief Hash of the name */
+    uint32_t m_hash;
+};
+
+/** @brief Errors of the conversion of an array by json_value::get_array() and json_value::get_columns() */
+enum class json_array_error : uint8_t
+{
+    /** @brief No error */
+    no_error,
+    /** @brief The value is not an array */
+    not_an_array,
+    /** @brief The storage is smaller than the array */
+    not_enough_memory,
+    /** @brief An element can't be converted to the storage type */
+    mixed_types,
+    /** @brief An element is not an object (json_value::get_columns() only) */
+    not_an_object,
+    /** @brief An element doesn't have the member of a column (json_value::get_columns() only) */
+    missing_member
+};
+
+/** @brief Result of the conversion of an array by json_value::get_array() and json_value::get_columns() */
+struct json_array_result
+{
+    /** @brief Number of converted elements, which is also the index of the element which can't be converted on error */
+    json_size_t count;
+    /** @brief Error */
+    json_array_error error;
 };
 
+class json_array_index;
+class json_object_index;
+class json_column;
+
 /** @brief Json value */
 class json_value
 {
   public:
     /** @brief Default constructor, needed for array and std::optional => Do not use!! */
-    json_value() : m_json_string(), m_desc(nullptr) { }
-    /** @brief Constructor */
-    json_value(const std::string_view& json_string, json_value_desc& desc) : m_json_string(json_string), m_desc(&desc) { }
+    json_value() : m_json_string(), m_desc(nullptr), m_number(nullptr) { }
+    /** @brief Constructor, number is the entry corresponding to the descriptor in the numbers array filled during parsing (if any) */
+    json_value(const std::string_view& json_string, json_value_desc& desc, json_number* number = nullptr)
+        : m_json_string(json_string), m_desc(&desc), m_number(number)
+    {
+    }
 
     /** @brief Get the type of the value */
     json_value_type type() const { return m_desc->type; }
@@ -106,17 +192,37 @@ class json_value
     /** @brief Indicate if the value is of the object type */
     bool is_object() const { return (type() == json_value_type::object); }
 
+    /** @brief Indicate if the value is an object/array which has not been parsed by a depth limited parsing :
+     *         its string representation is given by get() and it can be parsed using expand()
+     */
+    bool is_unexpanded() const { return (type() == json_value_type::unexpanded); }
+
+    /** @brief Parse an unexpanded object/array into other descriptors, up to a maximum depth relative to this value */
+    std::optional<json_value> expand(const std::span<json_value_desc>& descriptors, uint8_t max_depth = MAX_NESTING_LEVEL) const;
+
+    /** @brief Indicate if the value is a string which only contains ASCII chars : the result is stored during parsing
+     *         when NANOJSONCPP_USE_UTF8_VALIDATION is enabled, otherwise the string is checked at each call
+     */
+    bool is_ascii() const
+    {
+#ifdef NANOJSONCPP_USE_UTF8_VALIDATION
+        return (is_string() && m_desc->ascii);
+#else
+        return (is_string() && nanojsoncpp::is_ascii(get()));
+#endif // NANOJSONCPP_USE_UTF8_VALIDATION
+    }
+
     /** @brief Get the name of the value */
     std::string_view name() const { return m_json_string.substr(m_desc->name_start, m_desc->name_size); }
 
     /** @brief Get the size of the value :
      *         - For objects : number of members
      *         - For arrays : number of elements
-     *         - For other types : number of bytes of the string representation of the value
+     *         - For other types (including unexpanded objects/arrays) : number of bytes of the string representation of the value
      */
     json_size_t size() const { return m_desc->value_size; }
 
-    /** @brief Get the value as an integer or a boolean */
+    /** @brief Get the value as an integer or a boolean : the value converted during parsing is used if available */
     template <typename T, std::enable_if_t<std::is_integral_v<T>, bool> = true>
     T get() const
     {
@@ -124,19 +230,90 @@ class json_value
         {
             return (m_json_string.substr(m_desc->value_start, m_desc->value_size) == std::string_view("true"));
         }
+        else if ((m_number != nullptr) && (type() == json_value_type::integer))
+        {
+            return static_cast<T>(m_number->integer);
+        }
         else
         {
             return static_cast<T>(to_int(m_json_string.substr(m_desc->value_start, m_desc->value_size)));
         }
     }
 
-    /** @brief Get the value as a floating point */
+    /** @brief Get the value as a floating point : the value converted during parsing is used if available */
     template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
     T get() const
     {
-        return static_cast<T>(to_float(m_json_string.substr(m_desc->value_start, m_desc->value_size)));
+        if ((m_number != nullptr) && (type() == json_value_type::decimal))
+        {
+            return static_cast<T>(m_number->decimal);
+        }
+        else if ((m_number != nullptr) && (type() == json_value_type::integer))
+        {
+            return static_cast<T>(m_number->integer);
+        }
+        else
+        {
+            return static_cast<T>(to_float(m_json_string.substr(m_desc->value_start, m_desc->value_size)));
+        }
+    }
+
+    /** @brief Indicate if the integer and decimal values have been converted during parsing */
+    bool has_numbers() const { return (m_number != nullptr); }
+
+    /** @brief Convert all the elements of an array of numbers into a contiguous storage in a single loop over their descriptors :
+     *         a floating point storage accepts integer and decimal elements, an integral storage only accepts integer elements.
+     *         The conversion stops at the first element of another type (mixed_types error), the elements are converted as with get<T>()
+     */
+    template <typename T, std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, bool> = true>
+    json_array_result get_array(const std::span<T>& values) const
+    {
+        json_array_result result = {0u, json_array_error::no_error};
+
+        if (type() != json_value_type::array)
+        {
+            result.error = json_array_error::not_an_array;
+        }
+        else if (size() > values.size())
+        {
+            result.error = json_array_error::not_enough_memory;
+        }
+        else
+        {
+            // The elements preceding the first object/array element have contiguous descriptors
+            const json_value_desc* elements = (m_desc + 1u);
+            const json_number*     numbers  = get_number(m_number, 1);
+            while ((result.count < size()) && (result.error == json_array_error::no_error))
+            {
+                const json_value_desc& element = elements[result.count];
+                const json_number*     number  = ((numbers != nullptr) ? &numbers[result.count] : nullptr);
+                if (element.type == json_value_type::integer)
+                {
+                    values[result.count] = get_array_integer<T>(element, number);
+                    result.count++;
+                }
+                else if (std::is_floating_point_v<T> && (element.type == json_value_type::decimal))
+                {
+                    values[result.count] = get_array_decimal<T>(element, number);
+                    result.count++;
+                }
+                else
+                {
+                    result.error = json_array_error::mixed_types;
+                }
+            }
+        }
+
+        return result;
     }
 
+    /** @brief Extract the members of the objects of an array into columns (1 per member name) in a single pass over their descriptors :
+     *         the position of a member in an object is tried first in the next object so that the objects having the same key order
+     *         don't need any lookup. The extraction stops at the first element which is not an object or which doesn't have the member
+     *         of a column with a type accepted by the column
+     */
+    json_array_result get_columns(const std::span<json_column>& columns) const;
+
     /** @brief Get the value as a string view */
     std::string_view get() const { return m_json_string.substr(m_desc->value_start, m_desc->value_size); }
 
@@ -151,7 +328,9 @@ class json_value
         return get_escaped(std::span<char>(const_cast<char*>(unescaped_string.data()), unescaped_string.size()));
     }
 
-    /** @brief Get the value as an escaped string view */
+    /** @brief Get the value as an escaped string view, the \\uXXXX escaped chars are converted to UTF-8 :
+     *         the chars between the escaped chars are copied at once
+     */
     std::string_view get_escaped(const std::span<char>& buffer) const
     {
         std::string_view escaped_string;
@@ -159,69 +338,7 @@ class json_value
 
         if (buffer.size() >= unescaped_string.size())
         {
-            bool        escaped      = false;
-            json_size_t buffer_index = 0u;
-            for (char c : unescaped_string)
-            {
-                if (escaped)
-                {
-                    // Escaped char
-                    switch (c)
-                    {
-                        case '\\':
-                        case '/':
-                        case '"':
-                            // Char can be copied as-is
-                            break;
-
-                        case 'n':
-                            c = '\n';
-                            break;
-
-                        case 'r':
-                            c = '\r';
-                            break;
-
-                        case 'b':
-                            c = '\b';
-                            break;
-
-                        case 'f':
-                            c = '\f';
-                            break;
-
-                        case 't':
-                            c = '\t';
-                            break;
-
-                        default:
-                            // Unknown char
-                            break;
-                    }
-
-                    // Add escaped char to buffer
-                    buffer[buffer_index] = c;
-                    buffer_index++;
-                    escaped = false;
-                }
-                else
-                {
-                    if (c == '\\')
-                    {
-                        // Next is an escaped char
-                        escaped = true;
-                    }
-                    else
-                    {
-                        // Regular char => copy to buffer
-                        buffer[buffer_index] = c;
-                        buffer_index++;
-                    }
-                }
-            }
-
-            // Build resuting string view on top of provided buffer
-            escaped_string = std::string_view(buffer.data(), buffer_index);
+            escaped_string = std::string_view(buffer.data(), unescape(unescaped_string, buffer.data()));
         }
 
         return escaped_string;
@@ -230,6 +347,9 @@ class json_value
     /** @brief Get a member value (only for object types) */
     std::optional<json_value> get(const std::string_view& name) const
     {
+#ifdef NANOJSONCPP_USE_NAME_HASH
+        return get(json_key(name));
+#else
         std::optional<json_value> value;
 
         if (type() == json_value_type::object)
@@ -245,26 +365,88 @@ class json_value
         }
 
         return value;
+#endif // NANOJSONCPP_USE_NAME_HASH
     }
 
-    /** @brief Get an array value (only for array types) */
-    std::optional<json_value> get(json_size_t index) const
+    /** @brief Get a member value using a precomputed key (only for object types) */
+    std::optional<json_value> get(const json_key& key) const
     {
         std::optional<json_value> value;
 
-        if (type() == json_value_type::array)
+        if (type() == json_value_type::object)
         {
-            json_size_t val_index = 0u;
+#ifdef NANOJSONCPP_USE_NAME_HASH
+            // Compare hashes and sizes before comparing the names
+            const json_size_t hash = static_cast<json_size_t>(key.hash());
+            json_value_desc*  desc = (m_desc + 1u);
+            if (is_flat())
+            {
+                // Members are contiguous : scan them without following the siblings chain
+                for (json_size_t i = 0u; i < size(); i++)
+                {
+                    if ((desc[i].name_hash == hash) && is_named(desc[i], key.name()))
+                    {
+                        value = get_nested(desc[i]);
+                        break;
+                    }
+                }
+            }
+            else
+            {
+                for (json_size_t i = 0u; i < size(); i++)
+                {
+                    if ((desc->name_hash == hash) && is_named(*desc, key.name()))
+                    {
+                        value = get_nested(*desc);
+                        break;
+                    }
+                    desc = get_next_sibling(desc);
+                }
+            }
+#else
             for (const auto& val : (*this))
             {
-                if (val_index == index)
+                if (val.name() == key.name())
                 {
                     value = val;
                     break;
                 }
-                else
+            }
+#endif // NANOJSONCPP_USE_NAME_HASH
+        }
+
+        return value;
+    }
+
+    /** @brief Get an array value (only for array types) */
+    std::optional<json_value> get(json_size_t index) const
+    {
+        std::optional<json_value> value;
+
+        if (type() == json_value_type::array)
+        {
+            if (is_flat())
+            {
+                // Direct access
+                if (index < size())
+                {
+                    value = get_nested(m_desc[index + 1u]);
+                }
+            }
+            else
+            {
+                json_size_t val_index = 0u;
+                for (const auto& val : (*this))
                 {
-                    val_index++;
+                    if (val_index == index)
+                    {
+                        value = val;
+                        break;
+                    }
+                    else
+                    {
+                        val_index++;
+                    }
                 }
             }
         }
@@ -272,9 +454,23 @@ class json_value
         return value;
     }
 
+    /** @brief Indicate if the value is an object/array with no nested value below its direct members/elements
+     *         (they may be empty objects/arrays) : the nested values of such an object/array can be directly accessed by their index
+     */
+    bool is_flat() const
+    {
+        // The descriptors following an object/array are its nested values (all levels) :
+        // if there are no more nested values than members/elements, none of them has nested values
+        return (((m_desc->type == json_value_type::object) || (m_desc->type == json_value_type::array)) &&
+                (m_desc[m_desc->value_size + 1u].nesting_level <= m_desc->nesting_level));
+    }
+
     /** @brief Get a member value (only for object types) */
     std::optional<json_value> operator[](const std::string_view& name) const { return get(name); }
 
+    /** @brief Get a member value using a precomputed key (only for object types) */
+    std::optional<json_value> operator[](const json_key& key) const { return get(key); }
+
     /** @brief Get an array value (only for array types) */
     std::optional<json_value> operator[](json_size_t index) const { return get(index); }
 
@@ -283,22 +479,22 @@ class json_value
     {
       public:
         /** @brief Constructor */
-        iterator(const std::string_view& json_string, json_value_desc* desc) : m_json_string(json_string), m_desc(desc) { }
+        iterator(const std::string_view& json_string, json_value_desc* desc, json_number* number)
+            : m_json_string(json_string), m_desc(desc), m_number(number)
+        {
+        }
 
         /** @brief Increment operator */
         iterator& operator++()
         {
-            // Skip nested objects/arrays
-            const uint8_t nesting_level = m_desc->nesting_level;
-            do
-            {
-                m_desc++;
-            } while (m_desc->nesting_level > nesting_level);
+            json_value_desc* next = get_next_sibling(m_desc);
+            m_number              = get_number(m_number, (next - m_desc));
+            m_desc                = next;
             return (*this);
         }
 
         /** @brief Dereferencement operator */
-        json_value operator*() const { return json_value(m_json_string, *m_desc); }
+        json_value operator*() const { return json_value(m_json_string, *m_desc, m_number); }
 
         /** @brief Inequality operator */
         bool operator!=(const iterator& other) const { return (m_desc != other.m_desc); }
@@ -308,14 +504,20 @@ class json_value
         std::string_view m_json_string;
         /** @brief Corresponding descriptor */
         json_value_desc* m_desc;
+        /** @brief Corresponding converted number */
+        json_number* m_number;
     };
 
     /** @brief Get an iterator to the beginning of the value (works only with object and array values) */
-    iterator begin() const { return iterator(m_json_string, (m_desc + 1u)); }
+    iterator begin() const { return iterator(m_json_string, (m_desc + 1u), get_number(m_number, 1)); }
 
     /** @brief Get an iterator to the end of the value (works only with object and array values) */
     iterator end() const
     {
+#ifdef NANOJSONCPP_USE_SUBTREE_SIZE
+        // Subtree size is 0 for other types than objects and arrays => end = begin
+        json_value_desc* end = (m_desc + m_desc->subtree_size + 1u);
+#else
         // Default end = begin
         json_value_desc* end = (m_desc + 1u);
 
@@ -328,7 +530,8 @@ class json_value
                 end++;
             }
         }
-        return iterator(m_json_string, end);
+#endif // NANOJSONCPP_USE_SUBTREE_SIZE
+        return iterator(m_json_string, end, get_number(m_number, (end - m_desc)));
     }
 
   private:
@@ -336,99 +539,1009 @@ class json_value
     std::string_view m_json_string;
     /** @brief Corresponding descriptor */
     json_value_desc* m_desc;
-};
+    /** @brief Corresponding converted number, nullptr if the numbers have not been converted during parsing */
+    json_number* m_number;
 
-/** @brief Json parse error */
-enum class json_parse_error
-{
-    /** @brief No error */
-    no_error,
-    /** @brief Not enough memory */
-    not_enough_memory,
-    /** @brief Json string too big */
-    json_too_big,
-    /** @brief Not a json string */
-    not_a_json_string,
-    /** @brief Unexpected end of json string */
-    unexpected_end_of_json_string,
-    /** @brief Unexpected character */
-    unexpected_char,
-    /** @brief Expected an object's member name */
-    expected_member_name,
-    /** @brief Missing separator between member name and value */
-    missing_value_separator,
-    /** @brief Invalid value */
-    invalid_value,
-    /** @brief Invalid escaped char in the string */
-    invalid_escaped_char,
-    /** @brief Missing end of string */
-    missing_end_of_string,
-    /** @brief Maximum number of nesting levels reached */
-    max_nesting_level,
-    /** @brief Trailing char at the end of the json string */
-    trailing_chars,
+    /** @brief Get the converted number of the descriptor at the given offset from the descriptor of a converted number */
+    static json_number* get_number(json_number* number, ptrdiff_t offset) { return ((number != nullptr) ? (number + offset) : nullptr); }
 
-    /** @brief Number of errors */
-    count
-};
+    /** @brief Get a value nested in this value */
+    json_value get_nested(json_value_desc& desc) const { return json_value(m_json_string, desc, get_number(m_number, (&desc - m_desc))); }
 
-/** @brief Error strings */
-constexpr std::array<std::string_view, static_cast<size_t>(json_parse_error::count)> json_parse_error_str = {
-    "no_error",
-    "not_enough_memory",
-    "json_too_big",
-    "not_a_json_string",
-    "unexpected_end_of_json_string",
-    "unexpected_char",
-    "expected_member_name",
-    "missing_value_separator",
-    "invalid_value",
-    "invalid_escaped_char",
-    "missing_end_of_string",
-    "max_nesting_level",
-    "trailing_chars"};
+    /** @brief Convert an integer element for get_array() */
+    template <typename T>
+    T get_array_integer(const json_value_desc& desc, const json_number* number) const
+    {
+        T value;
+        if (number != nullptr)
+        {
+            value = static_cast<T>(number->integer);
+        }
+        else
+        {
+            const std::string_view str = m_json_string.substr(desc.value_start, desc.value_size);
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                // An integer which can't overflow json_int_t is converted exactly then rounded once, as to_float() does
+                if (str.size() <= static_cast<size_t>(std::numeric_limits<json_int_t>::digits10))
+                {
+                    value = static_cast<T>(static_cast<json_float_t>(to_int(str)));
+                }
+                else
+                {
+                    value = static_cast<T>(to_float(str));
+                }
+            }
+            else
+            {
+                value = static_cast<T>(to_int(str));
+            }
+        }
+        return value;
+    }
 
-/** @brief Parse error handler */
-using parse_error_handler_t = std::function<void(json_size_t index, json_parse_error error)>;
+    /** @brief Convert a decimal element for get_array() */
+    template <typename T>
+    T get_array_decimal(const json_value_desc& desc, const json_number* number) const
+    {
+        T value;
+        if (number != nullptr)
+        {
+            value = static_cast<T>(number->decimal);
+        }
+        else
+        {
+            value = static_cast<T>(to_float(m_json_string.substr(desc.value_start, desc.value_size)));
+        }
+        return value;
+    }
 
-/** @brief Parse a json string */
-std::optional<json_value> parse(const std::string_view&           json_string,
-                                const std::span<json_value_desc>& descriptors,
-                                parse_error_handler_t             error_handler = nullptr);
+#ifdef NANOJSONCPP_USE_NAME_HASH
+    /** @brief Check the name of a value */
+    bool is_named(const json_value_desc& desc, const std::string_view& name) const
+    {
+        return ((desc.name_size == name.size()) && (std::memcmp(&m_json_string[desc.name_start], name.data(), name.size()) == 0));
+    }
+#endif // NANOJSONCPP_USE_NAME_HASH
 
-/** @brief Generate the start of an object in the specified buffer */
-std::span<char> generate_object_begin(const std::string_view& name, const std::span<char>& buffer);
+    /** @brief Get the descriptor of the value following a value at the same nesting level (skip nested objects/arrays) */
+    static json_value_desc* get_next_sibling(json_value_desc* desc)
+    {
+#ifdef NANOJSONCPP_USE_SUBTREE_SIZE
+        desc += (desc->subtree_size + 1u);
+#else
+        const uint8_t nesting_level = desc->nesting_level;
+        do
+        {
+            desc++;
+        } while (desc->nesting_level > nesting_level);
+#endif // NANOJSONCPP_USE_SUBTREE_SIZE
+        return desc;
+    }
 
-/** @brief Generate the end of an object in the specified buffer */
-std::span<char> generate_object_end(const std::span<char>& buffer);
+    /** @brief Get the descriptor of the member of an object corresponding to a column (nullptr if not found), end is the descriptor
+     *         following the object : the position of the member in the previous object is tried before looking up the member
+     */
+    json_value_desc* find_column_member(json_value_desc* object, json_value_desc* end, json_column& column) const;
 
-/** @brief Generate the start of an array in the specified buffer */
-std::span<char> generate_array_begin(const std::string_view& name, const std::span<char>& buffer);
+    /** @brief Indicate if a descriptor has the name of a key */
+    bool has_key(const json_value_desc& desc, const json_key& key) const;
 
-/** @brief Generate the end of an array in the specified buffer */
-std::span<char> generate_array_end(const std::span<char>& buffer);
+    friend class json_array_index;
+    friend class json_object_index;
+    template <typename>
+    friend class json_stream_parser;
+};
 
-/** @brief Generate a null json value in the specified buffer */
-std::span<char> generate_value(const std::string_view& name, const std::span<char>& buffer);
+/** @brief Random access index over the elements of an array stored in a caller provided storage
+ *         (1 json_size_t per element) : gives a direct access to any element of an array containing objects/arrays
+ */
+class json_array_index
+{
+  public:
+    /** @brief Default constructor, needed for std::optional => Do not use!! */
+    json_array_index() : m_json_string(), m_desc(nullptr), m_number(nullptr), m_offsets() { }
 
-/** @brief Generate a boolean json value in the specified buffer */
-std::span<char> generate_value(const std::string_view& name, bool value, const std::span<char>& buffer);
+    /** @brief Build the index of an array */
+    static std::optional<json_array_index> build(const json_value& array, const std::span<json_size_t>& storage)
+    {
+        std::optional<json_array_index> index;
 
-/** @brief Generate a string json value in the specified buffer */
-std::span<char> generate_value(const std::string_view& name, const std::string_view& value, const std::span<char>& buffer);
+        if (array.is_array() && (storage.size() >= array.size()))
+        {
+            // Store the offset of each element from the array descriptor
+            json_value_desc* desc = (array.m_desc + 1u);
+            for (json_size_t i = 0u; i < array.size(); i++)
+            {
+                storage[i] = static_cast<json_size_t>(desc - array.m_desc);
+                desc       = json_value::get_next_sibling(desc);
+            }
+            index = json_array_index(array, storage.first(array.size()));
+        }
 
-/** @brief Generate an integer json value in the specified buffer */
-std::span<char> generate_value(const std::string_view& name, json_int_t value, const std::span<char>& buffer);
+        return index;
+    }
 
-/** @brief Generate a floating point json value in the specified buffer */
-std::span<char> generate_value(const std::string_view& name, json_float_t value, const std::span<char>& buffer);
+    /** @brief Get the number of elements of the array */
+    json_size_t size() const { return static_cast<json_size_t>(m_offsets.size()); }
 
-/** @brief Finalize json string generation */
-size_t generate_finalize(const std::span<char>& inital_buffer, const std::span<char>& current_buffer);
+    /** @brief Get an array value */
+    std::optional<json_value> get(json_size_t index) const
+    {
+        std::optional<json_value> value;
+        if (index < size())
+        {
+            value = (*this)[index];
+        }
+        return value;
+    }
+
+    /** @brief Get an array value without checking the index */
+    json_value operator[](json_size_t index) const
+    {
+        return json_value(m_json_string, m_desc[m_offsets[index]], json_value::get_number(m_number, m_offsets[index]));
+    }
+
+    /** @brief Random access iterator class to go through the array (usable with the standard algorithms) */
+    class iterator
+    {
+      public:
+        /** @brief Iterator category */
+        using iterator_category = std::random_access_iterator_tag;
+        /** @brief Type of the elements */
+        using value_type = json_value;
+        /** @brief Type of the distance between 2 iterators */
+        using difference_type = ptrdiff_t;
+        /** @brief Type returned by the dereferencement operator (elements are built on access) */
+        using reference = json_value;
+        /** @brief No pointer to the elements (elements are built on access) */
+        using pointer = void;
+
+        /** @brief Constructor */
+        iterator(const json_array_index& index, json_size_t position) : m_index(&index), m_position(position) { }
+
+        /** @brief Pre-increment operator */
+        iterator& operator++()
+        {
+            m_position++;
+            return (*this);
+        }
+
+        /** @brief Post-increment operator */
+        iterator operator++(int)
+        {
+            iterator previous = (*this);
+            m_position++;
+            return previous;
+        }
+
+        /** @brief Pre-decrement operator */
+        iterator& operator--()
+        {
+            m_position--;
+            return (*this);
+        }
+
+        /** @brief Post-decrement operator */
+        iterator operator--(int)
+        {
+            iterator previous = (*this);
+            m_position--;
+            return previous;
+        }
+
+        /** @brief Move forward */
+        iterator& operator+=(difference_type count)
+        {
+            m_position = get_position(count);
+            return (*this);
+        }
+
+        /** @brief Move backward */
+        iterator& operator-=(difference_type count)
+        {
+            m_position = get_position(-count);
+            return (*this);
+        }
+
+        /** @brief Get an iterator moved forward */
+        iterator operator+(difference_type count) const { return iterator(*m_index, get_position(count)); }
+
+        /** @brief Get an iterator moved forward */
+        friend iterator operator+(difference_type count, const iterator& it) { return (it + count); }
+
+        /** @brief Get an iterator moved backward */
+        iterator operator-(difference_type count) const { return iterator(*m_index, get_position(-count)); }
+
+        /** @brief Number of elements between 2 iterators */
+        difference_type operator-(const iterator& other) const
+        {
+            return (static_cast<difference_type>(m_position) - static_cast<difference_type>(other.m_position));
+        }
+
+        /** @brief Dereferencement operator */
+        json_value operator*() const { return (*m_index)[m_position]; }
+
+        /** @brief Access to an element relative to the iterator position */
+        json_value operator[](difference_type offset) const { return (*m_index)[get_position(offset)]; }
+
+        /** @brief Equality operator */
+        bool operator==(const iterator& other) const { return (m_position == other.m_position); }
+
+        /** @brief Inequality operator */
+        bool operator!=(const iterator& other) const { return (m_position != other.m_position); }
+
+        /** @brief Less than operator */
+        bool operator<(const iterator& other) const { return (m_position < other.m_position); }
+
+        /** @brief Greater than operator */
+        bool operator>(const iterator& other) const { return (m_position > other.m_position); }
+
+        /** @brief Less than or equal operator */
+        bool operator<=(const iterator& other) const { return (m_position <= other.m_position); }
+
+        /** @brief Greater than or equal operator */
+        bool operator>=(const iterator& other) const { return (m_position >= other.m_position); }
+
+      private:
+        /** @brief Array index */
+        const json_array_index* m_index;
+        /** @brief Position in the array */
+        json_size_t m_position;
+
+        /** @brief Get the position in the array relative to the iterator position */
+        json_size_t get_position(difference_type offset) const
+        {
+            return static_cast<json_size_t>(static_cast<difference_type>(m_position) + offset);
+        }
+    };
+
+    /** @brief Get an iterator to the beginning of the array */
+    iterator begin() const { return iterator(*this, 0u); }
+
+    /** @brief Get an iterator to the end of the array */
+    iterator end() const { return iterator(*this, size()); }
+
+  private:
+    /** @brief Constructor */
+    json_array_index(const json_value& array, const std::span<json_size_t>& offsets)
+        : m_json_string(array.m_json_string), m_desc(array.m_desc), m_number(array.m_number), m_offsets(offsets)
+    {
+    }
+
+    /** @brief Parsed json string */
+    std::string_view m_json_string;
+    /** @brief Array descriptor */
+    json_value_desc* m_desc;
+    /** @brief Converted number of the array descriptor, nullptr if the numbers have not been converted during parsing */
+    json_number* m_number;
+    /** @brief Offsets of the elements descriptors from the array descriptor */
+    std::span<json_size_t> m_offsets;
+};
+
+/** @brief Hash index over the members of an object stored in a caller provided storage : gives a direct access to any member
+ *         of an object by its name. The index is never modified once built and can then be shared between threads.
+ */
+class json_object_index
+{
+  public:
+    /** @brief Default constructor, needed for std::optional => Do not use!! */
+    json_object_index() : m_json_string(), m_desc(nullptr), m_number(nullptr), m_slots() { }
+
+    /** @brief Get the recommended storage size to index an object with the given number of members */
+    static constexpr size_t get_storage_size(json_size_t members_count)
+    {
+        // Power of 2 with at most 50% of the slots in use
+        size_t size = 2u;
+        while (size < (2u * static_cast<size_t>(members_count)))
+        {
+            size *= 2u;
+        }
+        return size;
+    }
+
+    /** @brief Build the index of an object (the storage must have more entries than the object has members) */
+    static std::optional<json_object_index> build(const json_value& object, const std::span<json_size_t>& storage)
+    {
+        std::optional<json_object_index> index;
+
+        if (object.is_object())
+        {
+            // Use the biggest power of 2 number of slots fitting in the storage
+            size_t slots_count = 1u;
+            while ((slots_count * 2u) <= storage.size())
+            {
+                slots_count *= 2u;
+            }
+            if ((slots_count > object.size()) && (slots_count <= storage.size()))
+            {
+                json_object_index new_index(object, storage.first(slots_count));
+                for (auto& slot : new_index.m_slots)
+                {
+                    slot = EMPTY_SLOT;
+                }
+
+                // Store the offset of each member from the object descriptor,
+                // only the first member is stored if a name is used several times
+                json_value_desc* desc = (object.m_desc + 1u);
+                for (json_size_t i = 0u; i < object.size(); i++)
+                {
+                    const size_t slot = new_index.find_slot(json_key(new_index.get_name(*desc)));
+                    if (new_index.m_slots[slot] == EMPTY_SLOT)
+                    {
+                        new_index.m_slots[slot] = static_cast<json_size_t>(desc - object.m_desc);
+                    }
+                    desc = json_value::get_next_sibling(desc);
+                }
+                index = new_index;
+            }
+        }
+
+        return index;
+    }
+
+    /** @brief Get a member value */
+    std::optional<json_value> get(const std::string_view& name) const { return get(json_key(name)); }
+
+    /** @brief Get a member value using a precomputed key */
+    std::optional<json_value> get(const json_key& key) const
+    {
+        std::optional<json_value> value;
+
+        const json_size_t offset = m_slots[find_slot(key)];
+        if (offset != EMPTY_SLOT)
+        {
+            value = json_value(m_json_string, m_desc[offset], json_value::get_number(m_number, offset));
+        }
+
+        return value;
+    }
+
+    /** @brief Get a member value */
+    std::optional<json_value> operator[](const std::string_view& name) const { return get(name); }
+
+    /** @brief Get a member value using a precomputed key */
+    std::optional<json_value> operator[](const json_key& key) const { return get(key); }
+
+  private:
+    /** @brief Marker of an empty slot (offset 0 is the object itself) */
+    static constexpr json_size_t EMPTY_SLOT = 0u;
+
+    /** @brief Constructor */
+    json_object_index(const json_value& object, const std::span<json_size_t>& slots)
+        : m_json_string(object.m_json_string), m_desc(object.m_desc), m_number(object.m_number), m_slots(slots)
+    {
+    }
+
+    /** @brief Get the name of a member */
+    std::string_view get_name(const json_value_desc& desc) const { return m_json_string.substr(desc.name_start, desc.name_size); }
+
+    /** @brief Get the slot containing a member name or the empty slot where it would be stored (linear probing) */
+    size_t find_slot(const json_key& key) const
+    {
+        const size_t mask = (m_slots.size() - 1u);
+        size_t       slot = (key.hash() & mask);
+        while ((m_slots[slot] != EMPTY_SLOT) && (get_name(m_desc[m_slots[slot]]) != key.name()))
+        {
+            slot = ((slot + 1u) & mask);
+        }
+        return slot;
+    }
+
+    /** @brief Parsed json string */
+    std::string_view m_json_string;
+    /** @brief Object descriptor */
+    json_value_desc* m_desc;
+    /** @brief Converted number of the object descriptor, nullptr if the numbers have not been converted during parsing */
+    json_number* m_number;
+    /** @brief Slots of the hash table containing the offsets of the members descriptors from the object descriptor */
+    std::span<json_size_t> m_slots;
+};
+
+/** @brief Column filled by json_value::get_columns() : values of a member of the objects of an array, stored in a caller provided storage.
+ *         The storage type gives the accepted member types : integers for integral types, integers and decimals for floating point types,
+ *         booleans for bool and strings for std::string_view (escaped chars are not converted)
+ */
+class json_column
+{
+  public:
+    /** @brief Constructor, the storage is not copied and must remain valid as long as the column is used */
+    template <typename T, std::enable_if_t<std::is_arithmetic_v<T> || std::is_same_v<T, std::string_view>, bool> = true>
+    json_column(const json_key& key, const std::span<T>& values)
+        : m_key(key), m_values(values.data()), m_size(values.size()), m_store(&store<T>), m_offset(0u)
+    {
+    }
+
+    /** @brief Get the key of the member */
+    const json_key& key() const { return m_key; }
+
+  private:
+    /** @brief Store a member value in the storage, returns false if its type is not accepted by the storage type */
+    template <typename T>
+    static bool store(void* values, json_size_t index, const json_value& value)
+    {
+        bool accepted = false;
+        if constexpr (std::is_same_v<T, std::string_view>)
+        {
+            accepted = value.is_string();
+            if (accepted)
+            {
+                static_cast<T*>(values)[index] = value.get();
+            }
+        }
+        else
+        {
+            if constexpr (std::is_same_v<T, bool>)
+            {
+                accepted = value.is_bool();
+            }
+            else if constexpr (std::is_integral_v<T>)
+            {
+                accepted = value.is_integer();
+            }
+            else
+            {
+                accepted = value.is_decimal();
+            }
+            if (accepted)
+            {
+                static_cast<T*>(values)[index] = value.get<T>();
+            }
+        }
+        return accepted;
+    }
+
+    /** @brief Key of the member */
+    json_key m_key;
+    /** @brief Storage */
+    void* m_values;
+    /** @brief Number of values of the storage */
+    size_t m_size;
+    /** @brief Store function corresponding to the storage type */
+    bool (*m_store)(void* values, json_size_t index, const json_value& value);
+    /** @brief Offset of the member descriptor from its object descriptor in the previous object, 0 if unknown */
+    json_size_t m_offset;
+
+    friend class json_value;
+};
+
+/** @brief Number of independent lanes used by get_stats() */
+constexpr size_t COLUMN_STATS_LANES = 8u;
+
+/** @brief Minimum, maximum and sum of the values of a column */
+template <typename T>
+struct json_column_stats
+{
+    /** @brief Type of the sum : 64 bits integers for the integral types */
+    using sum_t = std::conditional_t<std::is_floating_point_v<T>, T, std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>>;
+
+    /** @brief Minimum value */
+    T min;
+    /** @brief Maximum value */
+    T max;
+    /** @brief Sum of the values */
+    sum_t sum;
+};
+
+/** @brief Compute the minimum, maximum and sum of the values of a column (empty std::optional if there are no values) :
+ *         the values are processed by blocks of COLUMN_STATS_LANES values in independent lanes so that the compiler can use SIMD
+ *         instructions, floating point sums may then differ from the ones of a sequential loop in their last bits
+ */
+template <typename T, std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<std::remove_cv_t<T>, bool>, bool> = true>
+std::optional<json_column_stats<std::remove_cv_t<T>>> get_stats(const std::span<T>& values)
+{
+    using value_t = std::remove_cv_t<T>;
+    using sum_t   = typename json_column_stats<value_t>::sum_t;
+
+    std::optional<json_column_stats<value_t>> stats;
+
+    if (!values.empty())
+    {
+        const value_t* data = values.data();
+        value_t        mins[COLUMN_STATS_LANES];
+        value_t        maxs[COLUMN_STATS_LANES];
+        sum_t          sums[COLUMN_STATS_LANES];
+        for (size_t lane = 0u; lane < COLUMN_STATS_LANES; lane++)
+        {
+            mins[lane] = data[0u];
+            maxs[lane] = data[0u];
+            sums[lane] = 0;
+        }
+
+        // Blocks
+        const size_t blocks_end = (values.size() - (values.size() % COLUMN_STATS_LANES));
+        for (size_t i = 0u; i < blocks_end; i += COLUMN_STATS_LANES)
+        {
+            for (size_t lane = 0u; lane < COLUMN_STATS_LANES; lane++)
+            {
+                const value_t value = data[i + lane];
+                mins[lane]          = ((value < mins[lane]) ? value : mins[lane]);
+                maxs[lane]          = ((value > maxs[lane]) ? value : maxs[lane]);
+                sums[lane] += static_cast<sum_t>(value);
+            }
+        }
+
+        // Remaining values
+        for (size_t i = blocks_end; i < values.size(); i++)
+        {
+            mins[0u] = ((data[i] < mins[0u]) ? data[i] : mins[0u]);
+            maxs[0u] = ((data[i] > maxs[0u]) ? data[i] : maxs[0u]);
+            sums[0u] += static_cast<sum_t>(data[i]);
+        }
+
+        // Merge the lanes
+        json_column_stats<value_t> result = {mins[0u], maxs[0u], sums[0u]};
+        for (size_t lane = 1u; lane < COLUMN_STATS_LANES; lane++)
+        {
+            result.min = ((mins[lane] < result.min) ? mins[lane] : result.min);
+            result.max = ((maxs[lane] > result.max) ? maxs[lane] : result.max);
+            result.sum += sums[lane];
+        }
+        stats = result;
+    }
+
+    return stats;
+}
+
+/** @brief On-demand access to the values of a json string without descriptors : a value is only located when it is accessed,
+ *         the values preceding it are skipped and the nested objects/arrays are skipped by balancing their brackets.
+ *         Only the accessed values are checked, the whole json string can be validated beforehand using parse_count()
+ */
+class json_cursor
+{
+  public:
+    /** @brief Default constructor, needed for std::optional => Do not use!! */
+    json_cursor() : m_value(), m_name() { }
+
+    /** @brief Get the type of the value */
+    json_value_type type() const;
+
+    /** @brief Indicate if the value is null */
+    bool is_null() const { return (type() == json_value_type::null); }
+
+    /** @brief Indicate if the value is a boolean */
+    bool is_bool() const { return (type() == json_value_type::boolean); }
+
+    /** @brief Indicate if the value is a string */
+    bool is_string() const { return (type() == json_value_type::string); }
+
+    /** @brief Indicate if the value is an integer */
+    bool is_integer() const { return (type() == json_value_type::integer); }
+
+    /** @brief Indicate if the value is a decimal */
+    bool is_decimal() const { return ((type() == json_value_type::decimal) || is_integer()); }
+
+    /** @brief Indicate if the value is an array */
+    bool is_array() const { return (type() == json_value_type::array); }
+
+    /** @brief Indicate if the value is an object */
+    bool is_object() const { return (type() == json_value_type::object); }
+
+    /** @brief Get the name of the value (empty for array values) */
+    std::string_view name() const { return m_name; }
+
+    /** @brief Get the size of the value :
+     *         - For arrays and objects : number of members/elements (computed by going through the object/array)
+     *         - For other types : number of bytes of the string representation of the value
+     */
+    json_size_t size() const;
+
+    /** @brief Get the value as an integer or a boolean */
+    template <typename T, std::enable_if_t<std::is_integral_v<T>, bool> = true>
+    T get() const
+    {
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            return (get() == std::string_view("true"));
+        }
+        else
+        {
+            return static_cast<T>(to_int(get()));
+        }
+    }
+
+    /** @brief Get the value as a floating point */
+    template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+    T get() const
+    {
+        return static_cast<T>(to_float(get()));
+    }
+
+    /** @brief Get the value as a string view (string values without quotes, whole string representation for the other types) */
+    std::string_view get() const;
+
+    /** @brief Get a member value (only for object types) */
+    std::optional<json_cursor> get(const std::string_view& name) const;
+
+    /** @brief Get an array value (only for array types) */
+    std::optional<json_cursor> get(json_size_t index) const;
+
+    /** @brief Get a member value (only for object types) */
+    std::optional<json_cursor> operator[](const std::string_view& name) const { return get(name); }
+
+    /** @brief Get an array value (only for array types) */
+    std::optional<json_cursor> operator[](json_size_t index) const { return get(index); }
+
+    /** @brief Iterator class to go through objects and arrays */
+    class iterator
+    {
+      public:
+        /** @brief Constructor */
+        iterator(const std::optional<json_cursor>& cursor, bool is_member) : m_value(), m_name(), m_is_member(is_member)
+        {
+            set_cursor(cursor);
+        }
+
+        /** @brief Increment operator */
+        iterator& operator++()
+        {
+            set_cursor(json_cursor(m_value, m_name).get_next_sibling(m_is_member));
+            return (*this);
+        }
+
+        /** @brief Dereferencement operator */
+        json_cursor operator*() const { return json_cursor(m_value, m_name); }
+
+        /** @brief Inequality operator */
+        bool operator!=(const iterator& other) const { return (m_value.data() != other.m_value.data()); }
+
+      private:
+        /** @brief Part of the json string starting at the current member/element, empty at the end of the object/array */
+        std::string_view m_value;
+        /** @brief Name of the current member */
+        std::string_view m_name;
+        /** @brief Indicate if the iteration is done on the members of an object */
+        bool m_is_member;
+
+        /** @brief Set the current member/element */
+        void set_cursor(const std::optional<json_cursor>& cursor)
+        {
+            if (cursor)
+            {
+                m_value = cursor->m_value;
+                m_name  = cursor->m_name;
+            }
+            else
+            {
+                m_value = std::string_view();
+                m_name  = std::string_view();
+            }
+        }
+    };
+
+    /** @brief Get an iterator to the beginning of the value (works only with object and array values) */
+    iterator begin() const { return iterator(get_first_child(), is_object()); }
+
+    /** @brief Get an iterator to the end of the value (works only with object and array values) */
+    iterator end() const { return iterator(std::nullopt, false); }
+
+  private:
+    /** @brief Constructor */
+    json_cursor(const std::string_view& value, const std::string_view& name) : m_value(value), m_name(name) { }
+
+    /** @brief Get the first member/element of an object/array */
+    std::optional<json_cursor> get_first_child() const;
+
+    /** @brief Get the member/element following this one in its object/array */
+    std::optional<json_cursor> get_next_sibling(bool is_member) const;
+
+    /** @brief Locate a member/element starting at the given position */
+    static std::optional<json_cursor> get_child(const char* position, const char* end, bool is_member);
+
+    /** @brief Part of the json string starting at the first char of the value */
+    std::string_view m_value;
+    /** @brief Name of the value */
+    std::string_view m_name;
+
+    friend std::optional<json_cursor> parse_on_demand(const std::string_view& json_string);
+};
+
+/** @brief Json parse error */
+enum class json_parse_error
+{
+    /** @brief No error */
+    no_error,
+    /** @brief Not enough memory */
+    not_enough_memory,
+    /** @brief Json string too big */
+    json_too_big,
+    /** @brief Not a json string */
+    not_a_json_string,
+    /** @brief Unexpected end of json string */
+    unexpected_end_of_json_string,
+    /** @brief Unexpected character */
+    unexpected_char,
+    /** @brief Expected an object's member name */
+    expected_member_name,
+    /** @brief Missing separator between member name and value */
+    missing_value_separator,
+    /** @brief Invalid value */
+    invalid_value,
+    /** @brief Invalid escaped char in the string */
+    invalid_escaped_char,
+    /** @brief Missing end of string */
+    missing_end_of_string,
+    /** @brief Maximum number of nesting levels reached */
+    max_nesting_level,
+    /** @brief Trailing char at the end of the json string */
+    trailing_chars,
+    /** @brief Invalid UTF-8 sequence in a string (only detected when NANOJSONCPP_USE_UTF8_VALIDATION is enabled) */
+    invalid_utf8_char,
+
+    /** @brief Number of errors */
+    count
+};
+
+/** @brief Error strings */
+constexpr std::array<std::string_view, static_cast<size_t>(json_parse_error::count)> json_parse_error_str = {
+    "no_error",
+    "not_enough_memory",
+    "json_too_big",
+    "not_a_json_string",
+    "unexpected_end_of_json_string",
+    "unexpected_char",
+    "expected_member_name",
+    "missing_value_separator",
+    "invalid_value",
+    "invalid_escaped_char",
+    "missing_end_of_string",
+    "max_nesting_level",
+    "trailing_chars",
+    "invalid_utf8_char"};
+
+/** @brief Parse error handler */
+using parse_error_handler_t = std::function<void(json_size_t index, json_parse_error error)>;
+
+/** @brief Parse error handler ignoring all the errors : the error reporting code is removed from the parser */
+struct no_error_handler
+{
+    /** @brief Ignore an error */
+    void operator()(json_size_t, json_parse_error) const { }
+};
+
+/** @brief Parse a json string */
+std::optional<json_value> parse(const std::string_view&           json_string,
+                                const std::span<json_value_desc>& descriptors,
+                                parse_error_handler_t             error_handler = nullptr);
+
+/** @brief Parse a json string and report the errors to an error handler of any callable type (lambda, functor, no_error_handler...)
+ *         without going through a std::function : the parser is then inlined in the calling code
+ */
+template <typename ErrorHandler, std::enable_if_t<std::is_invocable_v<ErrorHandler&, json_size_t, json_parse_error>, bool> = true>
+std::optional<json_value> parse(const std::string_view& json_string, const std::span<json_value_desc>& descriptors, ErrorHandler&& error_handler);
+
+/** @brief Parse a json string and convert each integer/decimal value once, just after the scan which found its end : the binary values
+ *         are stored in a numbers array parallel to the descriptors (same index) so that get<T>() on them only loads the stored value.
+ *         Only the first min(descriptors.size(), numbers.size()) descriptors are used
+ */
+std::optional<json_value> parse(const std::string_view&           json_string,
+                                const std::span<json_value_desc>& descriptors,
+                                const std::span<json_number>&     numbers,
+                                parse_error_handler_t             error_handler = nullptr);
+
+/** @brief Parse a json string and convert each integer/decimal value once in a numbers array parallel to the descriptors,
+ *         report the errors to an error handler of any callable type
+ */
+template <typename ErrorHandler, std::enable_if_t<std::is_invocable_v<ErrorHandler&, json_size_t, json_parse_error>, bool> = true>
+std::optional<json_value> parse(const std::string_view&           json_string,
+                                const std::span<json_value_desc>& descriptors,
+                                const std::span<json_number>&     numbers,
+                                ErrorHandler&&                    error_handler);
+
+/** @brief Compiled set of paths selecting the values to store in descriptors : a path is a list of member names
+ *         and array indexes each preceded by a '/' (ex: "/device/id", "/readings/0/value"), a "*" component matches
+ *         any member/element of its parent. The member names are compared without converting their escaped chars,
+ *         and cannot contain '/' chars
+ */
+class json_path_filter
+{
+  public:
+    /** @brief Constructor, the paths are not copied and must remain valid as long as the filter is used */
+    json_path_filter(const std::span<const std::string_view>& paths);
+
+    /** @brief Indicate if the paths are valid : at most MAX_FILTER_PATHS paths of at most MAX_FILTER_PATH_DEPTH
+     *         non empty components and MAX_FILTER_PATH_SIZE chars
+     */
+    bool is_valid() const { return m_valid; }
+
+    /** @brief Get the mask of all the paths : bit N corresponds to the path N */
+    uint64_t get_paths() const
+    {
+        return ((m_paths.size() == MAX_FILTER_PATHS) ? ~static_cast<uint64_t>(0u) : ((static_cast<uint64_t>(1u) << m_paths.size()) - 1u));
+    }
+
+    /** @brief Among the given paths, get the ones made of the given number of components */
+    uint64_t get_ending_paths(uint64_t paths, uint8_t depth) const { return ((depth <= MAX_FILTER_PATH_DEPTH) ? (paths & m_ending[depth]) : 0u); }
+
+    /** @brief Among the given paths, get the ones whose component at the given depth (1 = first component)
+     *         matches an object's member name or an array's element index
+     */
+    uint64_t match(uint64_t paths, uint8_t depth, bool is_member, const std::string_view& name, json_size_t index) const;
+
+  private:
+    /** @brief Paths */
+    std::span<const std::string_view> m_paths;
+    /** @brief Indicate if the paths are valid */
+    bool m_valid;
+    /** @brief Mask of the paths for each number of components */
+    uint64_t m_ending[MAX_FILTER_PATH_DEPTH + 1u];
+    /** @brief Mask of the paths having a "*" component at each depth */
+    uint64_t m_wildcards[MAX_FILTER_PATH_DEPTH + 1u];
+    /** @brief Position of the '/' preceding each component of the paths, followed by the size of the path */
+    uint8_t m_separators[MAX_FILTER_PATHS][MAX_FILTER_PATH_DEPTH + 1u];
+};
+
+/** @brief Parse a json string and only store the values selected by a path filter and their parent objects/arrays,
+ *         the other values are checked but not stored (returns an empty std::optional if the filter is not valid)
+ */
+std::optional<json_value> parse(const std::string_view&           json_string,
+                                const std::span<json_value_desc>& descriptors,
+                                const json_path_filter&           filter,
+                                parse_error_handler_t             error_handler = nullptr);
+
+/** @brief Parse a json string and only store the values selected by a path filter and their parent objects/arrays,
+ *         report the errors to an error handler of any callable type
+ */
+template <typename ErrorHandler, std::enable_if_t<std::is_invocable_v<ErrorHandler&, json_size_t, json_parse_error>, bool> = true>
+std::optional<json_value> parse(const std::string_view&           json_string,
+                                const std::span<json_value_desc>& descriptors,
+                                const json_path_filter&           filter,
+                                ErrorHandler&&                    error_handler);
+
+/** @brief Parse a json string up to a maximum depth (the root object/array is at depth 1) : the objects/arrays beyond
+ *         this depth are checked but stored in a single descriptor of the json_value_type::unexpanded type
+ */
+std::optional<json_value> parse(const std::string_view&           json_string,
+                                const std::span<json_value_desc>& descriptors,
+                                uint8_t                           max_depth,
+                                parse_error_handler_t             error_handler = nullptr);
+
+/** @brief Parse a json string up to a maximum depth, report the errors to an error handler of any callable type */
+template <typename ErrorHandler, std::enable_if_t<std::is_invocable_v<ErrorHandler&, json_size_t, json_parse_error>, bool> = true>
+std::optional<json_value> parse(const std::string_view&           json_string,
+                                const std::span<json_value_desc>& descriptors,
+                                uint8_t                           max_depth,
+                                ErrorHandler&&                    error_handler);
+
+/** @brief Number of descriptors and nesting levels needed to parse a json string */
+struct json_count
+{
+    /** @brief Number of descriptors needed to parse the json string (including the end marker) */
+    json_size_t descriptors;
+    /** @brief Maximum number of nested objects/arrays (the root object/array is at level 1) */
+    uint8_t max_nesting_level;
+};
+
+/** @brief Validate a json string and count the descriptors needed to parse it, without writing any descriptor */
+std::optional<json_count> parse_count(const std::string_view& json_string, parse_error_handler_t error_handler = nullptr);
+
+/** @brief Validate a json string and count the descriptors needed to parse it, report the errors to an error handler of any callable type */
+template <typename ErrorHandler, std::enable_if_t<std::is_invocable_v<ErrorHandler&, json_size_t, json_parse_error>, bool> = true>
+std::optional<json_count> parse_count(const std::string_view& json_string, ErrorHandler&& error_handler);
+
+/** @brief Validate a json string without writing any descriptor : the grammar, the string escapes and the nesting of the objects/arrays
+ *         up to a maximum depth (the root object/array is at depth 1) are checked, the errors are the same as with parse()
+ */
+bool validate(const std::string_view& json_string, uint8_t max_depth = MAX_NESTING_LEVEL, parse_error_handler_t error_handler = nullptr);
+
+/** @brief Validate a json string without writing any descriptor, report the errors to an error handler of any callable type */
+template <typename ErrorHandler, std::enable_if_t<std::is_invocable_v<ErrorHandler&, json_size_t, json_parse_error>, bool> = true>
+bool validate(const std::string_view& json_string, uint8_t max_depth, ErrorHandler&& error_handler);
+
+/** @brief Get an on-demand access to the values of a json string without parsing it : only the root object/array is checked */
+std::optional<json_cursor> parse_on_demand(const std::string_view& json_string);
+
+/** @brief Base class for the visitors of parse_events() : a visitor only needs to define the methods corresponding
+ *         to the events it is interested in, the methods are called without virtual dispatch
+ */
+struct json_visitor
+{
+    /** @brief Start of an object */
+    void on_object_begin() { }
+    /** @brief End of an object */
+    void on_object_end() { }
+    /** @brief Start of an array */
+    void on_array_begin() { }
+    /** @brief End of an array */
+    void on_array_end() { }
+    /** @brief Name of the next member of an object (escaped chars are not converted) */
+    void on_key(const std::string_view&) { }
+    /** @brief Null value */
+    void on_null() { }
+    /** @brief Boolean value */
+    void on_bool(bool) { }
+    /** @brief String value (escaped chars are not converted) */
+    void on_string(const std::string_view&) { }
+    /** @brief Integer value */
+    void on_integer(json_int_t) { }
+    /** @brief Decimal value */
+    void on_decimal(json_float_t) { }
+};
+
+/** @brief Parse a json string and forward the parsed values to a visitor without storing them in descriptors,
+ *         returns false if the json string is invalid (the values preceding the error have already been forwarded)
+ */
+template <typename Visitor,
+          typename ErrorHandler = no_error_handler,
+          std::enable_if_t<std::is_invocable_v<ErrorHandler&, json_size_t, json_parse_error>, bool> = true>
+bool parse_events(const std::string_view& json_string, Visitor& visitor, ErrorHandler&& error_handler = ErrorHandler());
+
+/** @brief Resumable json parser for json strings received in several chunks (UART frames, TCP segments...) */
+template <typename ErrorHandler = no_error_handler>
+class json_stream_parser;
+
+/** @brief Storage of the documents parsed by parse_many() in the descriptors */
+enum class json_documents_storage : uint8_t
+{
+    /** @brief Each document is stored from the start of the descriptors, it is only valid until the next document is parsed */
+    reuse,
+    /** @brief Each document is stored after the previous one, all the parsed documents remain valid */
+    append
+};
+
+/** @brief Document parsed by parse_many() */
+struct json_document
+{
+    /** @brief Root object/array of the document */
+    json_value root;
+    /** @brief Position of the document in the json string */
+    size_t offset;
+    /** @brief Size of the document in chars */
+    size_t size;
+};
+
+/** @brief Iterable sequence of the documents of a newline delimited (NDJSON) or concatenated json string, see parse_many() */
+template <typename ErrorHandler = no_error_handler>
+class json_documents;
+
+/** @brief Parse the documents of a newline delimited (NDJSON) or concatenated json string one after the other,
+ *         the documents are parsed while iterating on the returned sequence and the iteration stops at the first invalid document
+ */
+template <typename ErrorHandler = no_error_handler,
+          std::enable_if_t<std::is_invocable_v<ErrorHandler&, json_size_t, json_parse_error>, bool> = true>
+json_documents<std::decay_t<ErrorHandler>> parse_many(const std::string_view&           json_string,
+                                                      const std::span<json_value_desc>& descriptors,
+                                                      json_documents_storage            storage       = json_documents_storage::reuse,
+                                                      ErrorHandler&&                    error_handler = ErrorHandler());
+
+/** @brief Generate the start of an object in the specified buffer */
+std::span<char> generate_object_begin(const std::string_view& name, const std::span<char>& buffer);
+
+/** @brief Generate the end of an object in the specified buffer */
+std::span<char> generate_object_end(const std::span<char>& buffer);
+
+/** @brief Generate the start of an array in the specified buffer */
+std::span<char> generate_array_begin(const std::string_view& name, const std::span<char>& buffer);
+
+/** @brief Generate the end of an array in the specified buffer */
+std::span<char> generate_array_end(const std::span<char>& buffer);
+
+/** @brief Generate a null json value in the specified buffer */
+std::span<char> generate_value(const std::string_view& name, const std::span<char>& buffer);
+
+/** @brief Generate a boolean json value in the specified buffer */
+std::span<char> generate_value(const std::string_view& name, bool value, const std::span<char>& buffer);
+
+/** @brief Generate a string json value in the specified buffer */
+std::span<char> generate_value(const std::string_view& name, const std::string_view& value, const std::span<char>& buffer);
+
+/** @brief Generate an integer json value in the specified buffer */
+std::span<char> generate_value(const std::string_view& name, json_int_t value, const std::span<char>& buffer);
+
+/** @brief Generate a floating point json value in the specified buffer */
+std::span<char> generate_value(const std::string_view& name, json_float_t value, const std::span<char>& buffer);
+
+/** @brief Finalize json string generation */
+size_t generate_finalize(const std::span<char>& inital_buffer, const std::span<char>& current_buffer);
 
 /** @brief Get the version string of the library */
 const std::string_view& get_version();
 
 } // namespace nanojsoncpp
 
+// Parser implementation
+#include <nanojsoncpp/private/parser.h>
+#include <nanojsoncpp/private/stream_parser.h>
+#include <nanojsoncpp/private/documents_parser.h>
+
 #endif // NANOJSONCPP_H
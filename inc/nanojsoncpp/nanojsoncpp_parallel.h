@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2025 c-jimenez
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef NANOJSONCPP_PARALLEL_H
+#define NANOJSONCPP_PARALLEL_H
+
+// This header is part of the optional nanojsoncpp_parallel library which needs std::thread support from the target platform
+
+// nanojsoncpp headers
+#include <nanojsoncpp/nanojsoncpp.h>
+
+namespace nanojsoncpp
+{
+
+/** @brief Number of chunks given to each thread by parse_many_parallel() : the threads which have finished their chunks
+ *         steal the remaining chunks of the other threads so that they all end at nearly the same time
+ */
+constexpr size_t PARALLEL_CHUNKS_PER_THREAD = 8u;
+
+/** @brief Minimum size of the part of a json string parsed by each thread in parse_parallel() : smaller json strings use less threads */
+constexpr size_t PARALLEL_MIN_PART_SIZE = 16u * 1024u;
+
+/** @brief Callback receiving the documents parsed by parse_many_parallel() : it is called concurrently by the threads,
+ *         each thread gives its index in [0;threads count[ and its documents are only valid during the call.
+ *         The offset of the documents in the json string allows to restore their input order
+ */
+using parallel_document_handler_t = std::function<void(size_t thread_index, const json_document& document)>;
+
+/** @brief Callback receiving the errors detected by parse_many_parallel() : it is called once per thread which found an invalid document,
+ *         the error index is relative to the start of the invalid document
+ */
+using parallel_error_handler_t = std::function<void(size_t document_offset, json_size_t index, json_parse_error error)>;
+
+/** @brief Parse the documents of a newline delimited json string (NDJSON) using several threads : the json string is split in chunks
+ *         at newline chars and the documents of each chunk are parsed by a thread using its own part of the descriptors.
+ *         The parsing stops as soon as an invalid document is found, returns false if an invalid document has been found
+ */
+bool parse_many_parallel(const std::string_view&            json_string,
+                         const std::span<json_value_desc>&  descriptors,
+                         size_t                             threads_count,
+                         const parallel_document_handler_t& document_handler,
+                         const parallel_error_handler_t&    error_handler = nullptr);
+
+/** @brief Parse a big json string using several threads (a 32 bits json_size_t is needed for json strings bigger than 64kB) : the json string
+ *         is split between the members/elements of the root object/array and each part is parsed by a thread using its own part of the descriptors,
+ *         the parts are then gathered at the start of the descriptors to give the same values as parse().
+ *         The json string is parsed again with parse() if it is invalid or if the descriptors of a thread are not big enough for its part,
+ *         so that the errors are reported as with parse()
+ */
+std::optional<json_value> parse_parallel(const std::string_view&           json_string,
+                                         const std::span<json_value_desc>& descriptors,
+                                         size_t                            threads_count,
+                                         parse_error_handler_t             error_handler = nullptr);
+
+} // namespace nanojsoncpp
+
+#endif // NANOJSONCPP_PARALLEL_H
@@ -39,6 +39,7 @@ using json_float_t = NANOJSONCPP_FLOAT_T;
 static_assert(std::is_integral_v<json_size_t> && std::is_unsigned_v<json_size_t> && (sizeof(json_size_t) >= sizeof(uint16_t)));
 static_assert(std::is_integral_v<json_int_t> && std::is_signed_v<json_int_t> && (sizeof(json_int_t) >= sizeof(int32_t)));
 static_assert(std::is_floating_point_v<json_float_t> && (sizeof(json_float_t) >= sizeof(float)));
+static_assert((NANOJSONCPP_MAX_NESTING_LEVEL >= 1) && (NANOJSONCPP_MAX_NESTING_LEVEL <= 255));
 
 } // namespace nanojsoncpp
 
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2025 c-jimenez
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef NANOJSONCPP_DIGITS_H
+#define NANOJSONCPP_DIGITS_H
+
+// Standard headers
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace nanojsoncpp
+{
+
+/** @brief Number of digits converted at once by parse_digits() */
+constexpr size_t SWAR_DIGITS_COUNT = 8u;
+
+/** @brief Load 8 chars of a json string in a 64 bits word, the first char being in the lowest byte whatever the CPU endianness */
+inline uint64_t load_eight_chars(const char* position)
+{
+    uint64_t word;
+    memcpy(&word, position, sizeof(word));
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    word = __builtin_bswap64(word);
+#endif // defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    return word;
+}
+
+/** @brief Indicate if the 8 chars of a word are all ASCII digits : the high nibble of each byte must be 3 and adding 6 to a digit must not
+ *         carry into the high nibble
+ */
+inline bool is_eight_digits(uint64_t word)
+{
+    return (((word & 0xF0F0F0F0F0F0F0F0ull) | (((word + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4u)) == 0x3333333333333333ull);
+}
+
+/** @brief Convert 8 ASCII digits loaded with load_eight_chars() : the digits are combined by pairs, then the pairs by 4 digits
+ *         and the 2 halves are finally combined by 2 multiplications
+ */
+inline uint32_t parse_eight_digits(uint64_t word)
+{
+    constexpr uint64_t MASK             = 0x000000FF000000FFull;
+    constexpr uint64_t HIGH_MULTIPLIERS = 100u + (1000000ull << 32u);
+    constexpr uint64_t LOW_MULTIPLIERS  = 1u + (10000ull << 32u);
+    word -= 0x3030303030303030ull;
+    word = (word * 10u) + (word >> 8u);
+    word = (((word & MASK) * HIGH_MULTIPLIERS) + (((word >> 16u) & MASK) * LOW_MULTIPLIERS)) >> 32u;
+    return static_cast<uint32_t>(word);
+}
+
+/** @brief Accumulate the ASCII digits starting at the given position in value (modulo 2^64), 8 digits at a time while enough
+ *         chars are available, returns the position of the first char which is not a digit
+ */
+inline const char* parse_digits(const char* begin, const char* end, uint64_t& value)
+{
+    const char* position = begin;
+    while ((end - position) >= static_cast<ptrdiff_t>(SWAR_DIGITS_COUNT))
+    {
+        const uint64_t word = load_eight_chars(position);
+        if (!is_eight_digits(word))
+        {
+            break;
+        }
+        value = (value * 100000000u) + parse_eight_digits(word);
+        position += SWAR_DIGITS_COUNT;
+    }
+    while ((position != end) && (*position >= '0') && (*position <= '9'))
+    {
+        value = (value * 10u) + static_cast<uint64_t>(*position - '0');
+        position++;
+    }
+    return position;
+}
+
+} // namespace nanojsoncpp
+
+#endif // NANOJSONCPP_DIGITS_H
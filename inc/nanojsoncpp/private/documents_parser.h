@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2025 c-jimenez
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef NANOJSONCPP_DOCUMENTS_PARSER_H
+#define NANOJSONCPP_DOCUMENTS_PARSER_H
+
+// This file is included at the end of nanojsoncpp.h and must not be included directly
+
+namespace nanojsoncpp
+{
+
+/** @brief Iterable sequence of the documents of a newline delimited (NDJSON) or concatenated json string :
+ *         each document is parsed when the sequence is iterated, the documents can be separated by blank chars or not separated at all.
+ *         The error indexes reported to the error handler are relative to the start of the invalid document given by get_offset()
+ */
+template <typename ErrorHandler>
+class json_documents
+{
+  public:
+    /** @brief Constructor */
+    json_documents(const std::string_view&           json_string,
+                   const std::span<json_value_desc>& descriptors,
+                   json_documents_storage            storage,
+                   ErrorHandler                      error_handler = ErrorHandler())
+        : m_error_handler(error_handler),
+          m_json_string(json_string),
+          m_descriptors(descriptors),
+          m_storage(storage),
+          m_offset(0u),
+          m_used_descriptors(0u),
+          m_success(true)
+    {
+    }
+
+    /** @brief Parse the next document, returns an empty value when all the documents have been parsed or if the document is invalid */
+    std::optional<json_document> next()
+    {
+        std::optional<json_document> document;
+
+        // Skip the blank chars between the documents
+        while (m_success && (m_offset != m_json_string.size()) && (get_char_class(m_json_string[m_offset]) == char_class::blank))
+        {
+            m_offset++;
+        }
+        if (m_success && (m_offset != m_json_string.size()))
+        {
+            // Parse the document, it is only limited in size by the maximum size of a json string
+            const std::string_view                        remaining = m_json_string.substr(m_offset);
+            const size_t                                  max_size  = std::min<size_t>(remaining.size(), MAX_JSON_STRING_SIZE);
+            desc_value_handler                            value_handler(m_descriptors.subspan(m_used_descriptors));
+            json_parser<ErrorHandler, desc_value_handler> parser(m_error_handler, value_handler);
+            parser.begin(remaining.data(), true);
+            parser.resume(max_size, (max_size != remaining.size()));
+            if (parser.is_successful() && !parser.is_complete())
+            {
+                // Error : The document doesn't end before the maximum size of a json string
+                parser.abort(json_parse_error::json_too_big);
+            }
+
+            const json_size_t         size = parser.get_parsed_size();
+            std::optional<json_value> root = parser.end(remaining.substr(0u, size));
+            if (root)
+            {
+                document = json_document{root.value(), m_offset, size};
+                m_offset += size;
+                if (m_storage == json_documents_storage::append)
+                {
+                    // The root of the next document replaces the end marker of this document :
+                    // its nesting level is the same so it still ends the values of this document
+                    m_used_descriptors += value_handler.get_values_count();
+                }
+            }
+            else
+            {
+                m_success = false;
+            }
+        }
+
+        return document;
+    }
+
+    /** @brief Indicate if no invalid document has been found */
+    bool is_successful() const { return m_success; }
+
+    /** @brief Get the position in the json string of the next document to parse (or of the invalid document) */
+    size_t get_offset() const { return m_offset; }
+
+    /** @brief Iterator class to go through the documents */
+    class iterator
+    {
+      public:
+        /** @brief Constructor, the first document is parsed if the sequence is given */
+        iterator(json_documents* documents) : m_documents(documents), m_document()
+        {
+            if (m_documents != nullptr)
+            {
+                m_document = m_documents->next();
+            }
+        }
+
+        /** @brief Increment operator */
+        iterator& operator++()
+        {
+            m_document = m_documents->next();
+            return (*this);
+        }
+
+        /** @brief Dereferencement operator */
+        const json_document& operator*() const { return *m_document; }
+
+        /** @brief Member access operator */
+        const json_document* operator->() const { return &(*m_document); }
+
+        /** @brief Inequality operator */
+        bool operator!=(const iterator& other) const { return (m_document.has_value() != other.m_document.has_value()); }
+
+      private:
+        /** @brief Documents */
+        json_documents* m_documents;
+        /** @brief Current document */
+        std::optional<json_document> m_document;
+    };
+
+    /** @brief Get an iterator to the first document, the documents can only be iterated once */
+    iterator begin() { return iterator(this); }
+
+    /** @brief Get an iterator to the end of the documents */
+    iterator end() { return iterator(nullptr); }
+
+  private:
+    /** @brief Error handler */
+    ErrorHandler m_error_handler;
+    /** @brief Json string containing the documents */
+    std::string_view m_json_string;
+    /** @brief Descriptors */
+    std::span<json_value_desc> m_descriptors;
+    /** @brief Storage of the documents in the descriptors */
+    json_documents_storage m_storage;
+    /** @brief Position of the next document */
+    size_t m_offset;
+    /** @brief Number of descriptors used by the previous documents */
+    size_t m_used_descriptors;
+    /** @brief Indicate if no invalid document has been found */
+    bool m_success;
+};
+
+/** @brief Parse the documents of a newline delimited (NDJSON) or concatenated json string one after the other */
+template <typename ErrorHandler, std::enable_if_t<std::is_invocable_v<ErrorHandler&, json_size_t, json_parse_error>, bool>>
+json_documents<std::decay_t<ErrorHandler>> parse_many(const std::string_view&           json_string,
+                                                      const std::span<json_value_desc>& descriptors,
+                                                      json_documents_storage            storage,
+                                                      ErrorHandler&&                    error_handler)
+{
+    return json_documents<std::decay_t<ErrorHandler>>(json_string, descriptors, storage, std::forward<ErrorHandler>(error_handler));
+}
+
+} // namespace nanojsoncpp
+
+#endif // NANOJSONCPP_DOCUMENTS_PARSER_H
@@ -0,0 +1,2299 @@
+/*
+ * Copyright (c) 2025 c-jimenez
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef NANOJSONCPP_PARSER_H
+#define NANOJSONCPP_PARSER_H
+
+// This file is included at the end of nanojsoncpp.h and must not be included directly
+
+// Standard headers
+#include <array>
+#include <limits>
+
+// nanojsoncpp headers
+#include <nanojsoncpp/private/digits.h>
+#ifdef NANOJSONCPP_USE_SIMD_SCAN
+#include <nanojsoncpp/private/scan.h>
+#endif // NANOJSONCPP_USE_SIMD_SCAN
+#ifdef NANOJSONCPP_USE_UTF8_VALIDATION
+#include <nanojsoncpp/private/utf8.h>
+#endif // NANOJSONCPP_USE_UTF8_VALIDATION
+
+namespace nanojsoncpp
+{
+
+/** @brief Internal state of the json parser */
+enum class parser_state : uint8_t
+{
+    start_of_json,
+    start_of_member_name,
+    member_name,
+    value_separator,
+    start_of_value,
+    member_separator,
+    end_of_json
+};
+
+/** @brief Class of a char in a json string */
+enum class char_class : uint8_t
+{
+    /** @brief Any char without meaning for the parser */
+    other,
+    /** @brief ' ', '\\t', '\\r', '\\n' */
+    blank,
+    /** @brief '"' */
+    quote,
+    /** @brief '\\' */
+    backslash,
+    /** @brief '{' */
+    begin_object,
+    /** @brief '}' */
+    end_object,
+    /** @brief '[' */
+    begin_array,
+    /** @brief ']' */
+    end_array,
+    /** @brief ':' */
+    name_separator,
+    /** @brief ',' */
+    value_separator,
+    /** @brief '0' to '9' */
+    digit,
+    /** @brief '-' */
+    minus,
+    /** @brief '.' */
+    decimal_point,
+    /** @brief 'n' */
+    null_literal,
+    /** @brief 't' */
+    true_literal,
+    /** @brief 'f' */
+    false_literal,
+    /** @brief 'e', 'E' */
+    exponent,
+    /** @brief '+' */
+    plus
+};
+
+#ifdef NANOJSONCPP_USE_CHAR_CLASS_TABLE
+
+/** @brief Build the table of the classes of all the chars */
+constexpr std::array<char_class, 256u> build_char_classes()
+{
+    std::array<char_class, 256u> classes = {};
+    for (auto& c : classes)
+    {
+        c = char_class::other;
+    }
+    classes[static_cast<uint8_t>(' ')]  = char_class::blank;
+    classes[static_cast<uint8_t>('\t')] = char_class::blank;
+    classes[static_cast<uint8_t>('\r')] = char_class::blank;
+    classes[static_cast<uint8_t>('\n')] = char_class::blank;
+    classes[static_cast<uint8_t>('"')]  = char_class::quote;
+    classes[static_cast<uint8_t>('\\')] = char_class::backslash;
+    classes[static_cast<uint8_t>('{')]  = char_class::begin_object;
+    classes[static_cast<uint8_t>('}')]  = char_class::end_object;
+    classes[static_cast<uint8_t>('[')]  = char_class::begin_array;
+    classes[static_cast<uint8_t>(']')]  = char_class::end_array;
+    classes[static_cast<uint8_t>(':')]  = char_class::name_separator;
+    classes[static_cast<uint8_t>(',')]  = char_class::value_separator;
+    for (char c = '0'; c <= '9'; c++)
+    {
+        classes[static_cast<uint8_t>(c)] = char_class::digit;
+    }
+    classes[static_cast<uint8_t>('-')] = char_class::minus;
+    classes[static_cast<uint8_t>('.')] = char_class::decimal_point;
+    classes[static_cast<uint8_t>('n')] = char_class::null_literal;
+    classes[static_cast<uint8_t>('t')] = char_class::true_literal;
+    classes[static_cast<uint8_t>('f')] = char_class::false_literal;
+    classes[static_cast<uint8_t>('e')] = char_class::exponent;
+    classes[static_cast<uint8_t>('E')] = char_class::exponent;
+    classes[static_cast<uint8_t>('+')] = char_class::plus;
+    return classes;
+}
+
+/** @brief Classes of all the chars */
+inline constexpr std::array<char_class, 256u> CHAR_CLASSES = build_char_classes();
+
+#endif // NANOJSONCPP_USE_CHAR_CLASS_TABLE
+
+/** @brief Get the class of a char */
+inline char_class get_char_class(char c)
+{
+#ifdef NANOJSONCPP_USE_CHAR_CLASS_TABLE
+    return CHAR_CLASSES[static_cast<uint8_t>(c)];
+#else
+    char_class c_class = char_class::other;
+    switch (c)
+    {
+        case ' ':
+        case '\t':
+        case '\r':
+        case '\n':
+            c_class = char_class::blank;
+            break;
+
+        case '"':
+            c_class = char_class::quote;
+            break;
+
+        case '\\':
+            c_class = char_class::backslash;
+            break;
+
+        case '{':
+            c_class = char_class::begin_object;
+            break;
+
+        case '}':
+            c_class = char_class::end_object;
+            break;
+
+        case '[':
+            c_class = char_class::begin_array;
+            break;
+
+        case ']':
+            c_class = char_class::end_array;
+            break;
+
+        case ':':
+            c_class = char_class::name_separator;
+            break;
+
+        case ',':
+            c_class = char_class::value_separator;
+            break;
+
+        case '-':
+            c_class = char_class::minus;
+            break;
+
+        case '.':
+            c_class = char_class::decimal_point;
+            break;
+
+        case 'n':
+            c_class = char_class::null_literal;
+            break;
+
+        case 't':
+            c_class = char_class::true_literal;
+            break;
+
+        case 'f':
+            c_class = char_class::false_literal;
+            break;
+
+        case 'e':
+        case 'E':
+            c_class = char_class::exponent;
+            break;
+
+        case '+':
+            c_class = char_class::plus;
+            break;
+
+        default:
+            if ((c >= '0') && (c <= '9'))
+            {
+                c_class = char_class::digit;
+            }
+            break;
+    }
+    return c_class;
+#endif // NANOJSONCPP_USE_CHAR_CLASS_TABLE
+}
+
+/** @brief Value handler of the json parser storing the parsed values in descriptors */
+class desc_value_handler
+{
+  public:
+    /** @brief Constructor */
+    desc_value_handler(const std::span<json_value_desc>& descriptors)
+        : m_descriptors(descriptors), m_values_index(0u), m_parent_value_desc(nullptr), m_current_value_desc(nullptr)
+    {
+    }
+
+    /** @brief Forget the values of the previous json string */
+    void reset() { m_values_index = 0u; }
+
+    /** @brief Check that at least 1 value can be parsed (root + end marker) */
+    bool can_start() const { return (m_descriptors.size() > 1u); }
+
+    /** @brief Indicate if the root object/array has been started */
+    bool is_started() const { return (m_values_index != 0u); }
+
+    /** @brief Indicate if no more memory is available to store a value */
+    bool is_full() const { return (m_values_index == m_descriptors.size()); }
+
+    /** @brief Get the type of the current object/array */
+    json_value_type get_parent_type() const { return m_parent_value_desc->type; }
+
+    /** @brief Indicate if no value has been added to the current object/array */
+    bool is_parent_empty() const { return (m_parent_value_desc->value_size == 0u); }
+
+    /** @brief Get the descriptor of the root object/array */
+    json_value_desc& get_root() { return m_descriptors[0u]; }
+
+    /** @brief Get the number of members/elements added to the root object/array */
+    json_size_t get_root_size() const { return m_descriptors[0u].value_size; }
+
+    /** @brief Get the number of descriptors used by the parsed values (without the end marker) */
+    json_size_t get_values_count() const { return m_values_index; }
+
+    /** @brief Get the descriptor of the last added value */
+    json_value_desc& get_last_value() { return *(m_current_value_desc - 1u); }
+
+    /** @brief Start the root object/array */
+    void start_root(json_value_type type, json_size_t value_start)
+    {
+        m_values_index       = 1u;
+        m_parent_value_desc  = &m_descriptors[0u];
+        m_current_value_desc = &m_descriptors[1u];
+        m_parents[0u]        = 0u;
+
+        json_value_desc& root_value_desc = m_descriptors[0u];
+        root_value_desc.nesting_level    = 0u;
+        root_value_desc.type             = type;
+        root_value_desc.name_start       = 0u;
+        root_value_desc.name_size        = 0u;
+        root_value_desc.value_start      = value_start;
+        root_value_desc.value_size       = 0u;
+#ifdef NANOJSONCPP_USE_SUBTREE_SIZE
+        root_value_desc.subtree_size = 0u;
+#endif // NANOJSONCPP_USE_SUBTREE_SIZE
+    }
+
+    /** @brief Start the root object/array in the middle of its members/elements : the root descriptor
+     *         counts 1 member/element parsed before so that the root object/array is not empty
+     */
+    void resume_root(json_value_type type)
+    {
+        start_root(type, 0u);
+        m_descriptors[0u].value_size = 1u;
+    }
+
+    /** @brief Start a new value in the current object/array */
+    void start_value(uint8_t nesting_level)
+    {
+        // Clear value name for array values
+        if (m_parent_value_desc->type == json_value_type::array)
+        {
+            m_current_value_desc->name_start = 0u;
+            m_current_value_desc->name_size  = 0u;
+        }
+
+        // Set nesting level
+        m_current_value_desc->nesting_level = nesting_level;
+#ifdef NANOJSONCPP_USE_SUBTREE_SIZE
+        m_current_value_desc->subtree_size = 0u;
+#endif // NANOJSONCPP_USE_SUBTREE_SIZE
+    }
+
+    /** @brief Set the name of the new value in the current object */
+    void set_name(json_size_t name_start, const std::string_view& name)
+    {
+        m_current_value_desc->name_start = name_start;
+        m_current_value_desc->name_size  = static_cast<json_size_t>(name.size());
+#ifdef NANOJSONCPP_USE_NAME_HASH
+        m_current_value_desc->name_hash = static_cast<json_size_t>(hash_name(name));
+#endif // NANOJSONCPP_USE_NAME_HASH
+    }
+
+    /** @brief Add a null, boolean, string or number value to the current object/array,
+     *         ascii indicates if a string value only contains ASCII chars
+     */
+    void add_value(json_value_type type, json_size_t value_start, const std::string_view& value, bool ascii)
+    {
+        // Save position
+        m_current_value_desc->type        = type;
+        m_current_value_desc->value_start = value_start;
+        m_current_value_desc->value_size  = static_cast<json_size_t>(value.size());
+#ifdef NANOJSONCPP_USE_UTF8_VALIDATION
+        m_current_value_desc->ascii = ascii;
+#else
+        (void)ascii;
+#endif // NANOJSONCPP_USE_UTF8_VALIDATION
+        m_current_value_desc++;
+        m_values_index++;
+
+        // Update parent
+        m_parent_value_desc->value_size++;
+    }
+
+    /** @brief Add an integer value already converted by the parser to the current object/array */
+    void add_integer_value(json_size_t value_start, const std::string_view& value, json_int_t)
+    {
+        add_value(json_value_type::integer, value_start, value, true);
+    }
+
+    /** @brief Add an object/array value to the current object/array, it becomes the current object/array */
+    void begin_compound_value(json_value_type type, json_size_t value_start, uint8_t nesting_level)
+    {
+        // Update parent
+        m_parent_value_desc->value_size++;
+        m_parent_value_desc      = m_current_value_desc;
+        m_parents[nesting_level] = m_values_index;
+
+        // Save position
+        m_current_value_desc->type        = type;
+        m_current_value_desc->value_start = value_start;
+        m_current_value_desc->value_size  = 0u;
+        m_current_value_desc++;
+        m_values_index++;
+    }
+
+    /** @brief End the current object/array, its parent becomes the current object/array */
+    void end_compound_value(uint8_t nesting_level, json_size_t)
+    {
+#ifdef NANOJSONCPP_USE_SUBTREE_SIZE
+        // Number of nested values = number of values parsed since the object/array opening
+        const json_size_t closed_index           = m_parents[nesting_level];
+        m_descriptors[closed_index].subtree_size = static_cast<json_size_t>(m_values_index - closed_index - 1u);
+#endif // NANOJSONCPP_USE_SUBTREE_SIZE
+
+        // Update parent
+        if (nesting_level != 0u)
+        {
+            m_parent_value_desc = &m_descriptors[m_parents[nesting_level - 1u]];
+        }
+    }
+
+    /** @brief Set the end marker after the last value, only the nesting level is set when the parsing is not complete
+     *         so that the values already parsed can be browsed without modifying the value being parsed
+     */
+    void set_end_marker(bool complete)
+    {
+        m_current_value_desc->nesting_level = 0u;
+        if (complete)
+        {
+            m_current_value_desc->name_start  = 0u;
+            m_current_value_desc->name_size   = 0u;
+            m_current_value_desc->value_start = 0u;
+            m_current_value_desc->value_size  = 0u;
+#ifdef NANOJSONCPP_USE_SUBTREE_SIZE
+            m_current_value_desc->subtree_size = 0u;
+#endif // NANOJSONCPP_USE_SUBTREE_SIZE
+        }
+    }
+
+  private:
+    /** @brief Descriptors */
+    std::span<json_value_desc> m_descriptors;
+    /** @brief Index of the current descriptor */
+    json_size_t m_values_index;
+    /** @brief Descriptor of the current object/array */
+    json_value_desc* m_parent_value_desc;
+    /** @brief Current descriptor */
+    json_value_desc* m_current_value_desc;
+    /** @brief Indexes of the descriptors of the opened objects/arrays */
+    json_size_t m_parents[MAX_NESTING_LEVEL];
+};
+
+/** @brief Types of the opened objects/arrays, used by the value handlers which don't store descriptors */
+class compound_types
+{
+  public:
+    /** @brief Constructor */
+    compound_types() : m_parent_empty(true), m_parent_type(json_value_type::null), m_types() { }
+
+    /** @brief Get the type of the current object/array */
+    json_value_type get_parent_type() const { return m_parent_type; }
+
+    /** @brief Indicate if no value has been added to the current object/array */
+    bool is_parent_empty() const { return m_parent_empty; }
+
+    /** @brief A value has been added to the current object/array */
+    void add_value() { m_parent_empty = false; }
+
+    /** @brief An object/array has been opened, it becomes the current object/array */
+    void push(json_value_type type, uint8_t nesting_level)
+    {
+        m_types[nesting_level] = type;
+        m_parent_type          = type;
+        m_parent_empty         = true;
+    }
+
+    /** @brief The current object/array has been closed, its parent becomes the current object/array */
+    void pop(uint8_t nesting_level)
+    {
+        if (nesting_level != 0u)
+        {
+            m_parent_type = m_types[nesting_level - 1u];
+        }
+        m_parent_empty = false;
+    }
+
+  private:
+    /** @brief Indicate if no value has been added to the current object/array */
+    bool m_parent_empty;
+    /** @brief Type of the current object/array */
+    json_value_type m_parent_type;
+    /** @brief Types of the opened objects/arrays */
+    json_value_type m_types[MAX_NESTING_LEVEL];
+};
+
+/** @brief Value handler of the json parser forwarding the parsed values to a visitor instead of storing them,
+ *         only the type of the opened objects/arrays is stored
+ */
+template <typename Visitor>
+class visitor_value_handler
+{
+  public:
+    /** @brief Constructor */
+    visitor_value_handler(Visitor& visitor) : m_visitor(visitor), m_started(false), m_types() { }
+
+    /** @brief Forget the values of the previous json string */
+    void reset() { m_started = false; }
+
+    /** @brief Check that at least 1 value can be parsed */
+    bool can_start() const { return true; }
+
+    /** @brief Indicate if the root object/array has been started */
+    bool is_started() const { return m_started; }
+
+    /** @brief Indicate if no more memory is available to store a value */
+    bool is_full() const { return false; }
+
+    /** @brief Get the type of the current object/array */
+    json_value_type get_parent_type() const { return m_types.get_parent_type(); }
+
+    /** @brief Indicate if no value has been added to the current object/array */
+    bool is_parent_empty() const { return m_types.is_parent_empty(); }
+
+    /** @brief Start the root object/array */
+    void start_root(json_value_type type, json_size_t)
+    {
+        m_started = true;
+        begin_compound_value(type, 0u, 0u);
+    }
+
+    /** @brief Start a new value in the current object/array */
+    void start_value(uint8_t) { }
+
+    /** @brief Set the name of the new value in the current object */
+    void set_name(json_size_t, const std::string_view& name) { m_visitor.on_key(name); }
+
+    /** @brief Add a null, boolean, string or number value to the current object/array */
+    void add_value(json_value_type type, json_size_t, const std::string_view& value, bool)
+    {
+        switch (type)
+        {
+            case json_value_type::null:
+                m_visitor.on_null();
+                break;
+
+            case json_value_type::boolean:
+                m_visitor.on_bool(value == std::string_view("true"));
+                break;
+
+            case json_value_type::string:
+                m_visitor.on_string(value);
+                break;
+
+            case json_value_type::integer:
+                m_visitor.on_integer(to_int(value));
+                break;
+
+            default:
+                m_visitor.on_decimal(to_float(value));
+                break;
+        }
+        m_types.add_value();
+    }
+
+    /** @brief Add an integer value already converted by the parser to the current object/array */
+    void add_integer_value(json_size_t, const std::string_view&, json_int_t integer)
+    {
+        m_visitor.on_integer(integer);
+        m_types.add_value();
+    }
+
+    /** @brief Add an object/array value to the current object/array, it becomes the current object/array */
+    void begin_compound_value(json_value_type type, json_size_t, uint8_t nesting_level)
+    {
+        if (type == json_value_type::object)
+        {
+            m_visitor.on_object_begin();
+        }
+        else
+        {
+            m_visitor.on_array_begin();
+        }
+        m_types.push(type, nesting_level);
+    }
+
+    /** @brief End the current object/array, its parent becomes the current object/array */
+    void end_compound_value(uint8_t nesting_level, json_size_t)
+    {
+        if (m_types.get_parent_type() == json_value_type::object)
+        {
+            m_visitor.on_object_end();
+        }
+        else
+        {
+            m_visitor.on_array_end();
+        }
+        m_types.pop(nesting_level);
+    }
+
+    /** @brief Set the end marker after the last value */
+    void set_end_marker(bool) { }
+
+  private:
+    /** @brief Visitor */
+    Visitor& m_visitor;
+    /** @brief Indicate if the root object/array has been started */
+    bool m_started;
+    /** @brief Types of the opened objects/arrays */
+    compound_types m_types;
+};
+
+/** @brief Value handler of the json parser counting the values and the nesting levels without storing them */
+class count_value_handler
+{
+  public:
+    /** @brief Constructor */
+    count_value_handler() : m_count(), m_types() { }
+
+    /** @brief Forget the values of the previous json string */
+    void reset() { m_count = {0u, 0u}; }
+
+    /** @brief Check that at least 1 value can be parsed */
+    bool can_start() const { return true; }
+
+    /** @brief Indicate if the root object/array has been started */
+    bool is_started() const { return (m_count.descriptors != 0u); }
+
+    /** @brief Indicate if no more memory is available to store a value */
+    bool is_full() const { return false; }
+
+    /** @brief Get the type of the current object/array */
+    json_value_type get_parent_type() const { return m_types.get_parent_type(); }
+
+    /** @brief Indicate if no value has been added to the current object/array */
+    bool is_parent_empty() const { return m_types.is_parent_empty(); }
+
+    /** @brief Get the counters, the end marker is included in the number of descriptors */
+    json_count get_count() const { return {static_cast<json_size_t>(m_count.descriptors + 1u), m_count.max_nesting_level}; }
+
+    /** @brief Start the root object/array */
+    void start_root(json_value_type type, json_size_t) { begin_compound_value(type, 0u, 0u); }
+
+    /** @brief Start a new value in the current object/array */
+    void start_value(uint8_t) { }
+
+    /** @brief Set the name of the new value in the current object */
+    void set_name(json_size_t, const std::string_view&) { }
+
+    /** @brief Add a null, boolean, string or number value to the current object/array */
+    void add_value(json_value_type, json_size_t, const std::string_view&, bool)
+    {
+        m_count.descriptors++;
+        m_types.add_value();
+    }
+
+    /** @brief Add an integer value already converted by the parser to the current object/array */
+    void add_integer_value(json_size_t, const std::string_view&, json_int_t)
+    {
+        m_count.descriptors++;
+        m_types.add_value();
+    }
+
+    /** @brief Add an object/array value to the current object/array, it becomes the current object/array */
+    void begin_compound_value(json_value_type type, json_size_t, uint8_t nesting_level)
+    {
+        m_count.descriptors++;
+        if (nesting_level == m_count.max_nesting_level)
+        {
+            m_count.max_nesting_level++;
+        }
+        m_types.push(type, nesting_level);
+    }
+
+    /** @brief End the current object/array, its parent becomes the current object/array */
+    void end_compound_value(uint8_t nesting_level, json_size_t) { m_types.pop(nesting_level); }
+
+    /** @brief Set the end marker after the last value */
+    void set_end_marker(bool) { }
+
+  private:
+    /** @brief Counters */
+    json_count m_count;
+    /** @brief Types of the opened objects/arrays */
+    compound_types m_types;
+};
+
+/** @brief Value handler of the json parser only checking the json string : only the type of the opened objects/arrays is stored */
+class validate_value_handler
+{
+  public:
+    /** @brief Constructor */
+    validate_value_handler() : m_started(false), m_types() { }
+
+    /** @brief Forget the values of the previous json string */
+    void reset() { m_started = false; }
+
+    /** @brief Check that at least 1 value can be parsed */
+    bool can_start() const { return true; }
+
+    /** @brief Indicate if the root object/array has been started */
+    bool is_started() const { return m_started; }
+
+    /** @brief Indicate if no more memory is available to store a value */
+    bool is_full() const { return false; }
+
+    /** @brief Get the type of the current object/array */
+    json_value_type get_parent_type() const { return m_types.get_parent_type(); }
+
+    /** @brief Indicate if no value has been added to the current object/array */
+    bool is_parent_empty() const { return m_types.is_parent_empty(); }
+
+    /** @brief Start the root object/array */
+    void start_root(json_value_type type, json_size_t)
+    {
+        m_started = true;
+        m_types.push(type, 0u);
+    }
+
+    /** @brief Start a new value in the current object/array */
+    void start_value(uint8_t) { }
+
+    /** @brief Set the name of the new value in the current object */
+    void set_name(json_size_t, const std::string_view&) { }
+
+    /** @brief Add a null, boolean, string or number value to the current object/array */
+    void add_value(json_value_type, json_size_t, const std::string_view&, bool) { m_types.add_value(); }
+
+    /** @brief Add an integer value already converted by the parser to the current object/array */
+    void add_integer_value(json_size_t, const std::string_view&, json_int_t) { m_types.add_value(); }
+
+    /** @brief Add an object/array value to the current object/array, it becomes the current object/array */
+    void begin_compound_value(json_value_type type, json_size_t, uint8_t nesting_level) { m_types.push(type, nesting_level); }
+
+    /** @brief End the current object/array, its parent becomes the current object/array */
+    void end_compound_value(uint8_t nesting_level, json_size_t) { m_types.pop(nesting_level); }
+
+    /** @brief Set the end marker after the last value */
+    void set_end_marker(bool) { }
+
+  private:
+    /** @brief Indicate if the root object/array has been started */
+    bool m_started;
+    /** @brief Types of the opened objects/arrays */
+    compound_types m_types;
+};
+
+/** @brief Value handler of the json parser only storing in descriptors the values selected by a path filter
+ *         and their parent objects/arrays : the stored objects/arrays are always the first opened ones
+ */
+class filter_value_handler
+{
+  public:
+    /** @brief Constructor */
+    filter_value_handler(const std::span<json_value_desc>& descriptors, const json_path_filter& filter)
+        : m_values(descriptors),
+          m_filter(filter),
+          m_types(),
+          m_stored_levels(0u),
+          m_match_level(NO_MATCH),
+          m_value_level(0u),
+          m_name_start(0u),
+          m_name(),
+          m_paths(),
+          m_indexes()
+    {
+    }
+
+    /** @brief Forget the values of the previous json string */
+    void reset() { m_values.reset(); }
+
+    /** @brief Check that at least 1 value can be parsed (root + end marker) */
+    bool can_start() const { return m_values.can_start(); }
+
+    /** @brief Indicate if the root object/array has been started */
+    bool is_started() const { return m_values.is_started(); }
+
+    /** @brief Indicate if no more memory is available to store a value */
+    bool is_full() const { return m_values.is_full(); }
+
+    /** @brief Get the type of the current object/array */
+    json_value_type get_parent_type() const { return m_types.get_parent_type(); }
+
+    /** @brief Indicate if no value has been added to the current object/array */
+    bool is_parent_empty() const { return m_types.is_parent_empty(); }
+
+    /** @brief Get the descriptor of the root object/array */
+    json_value_desc& get_root() { return m_values.get_root(); }
+
+    /** @brief Get the number of members/elements added to the root object/array */
+    json_size_t get_root_size() const { return m_values.get_root_size(); }
+
+    /** @brief Start the root object/array */
+    void start_root(json_value_type type, json_size_t value_start)
+    {
+        m_values.start_root(type, value_start);
+        m_types.push(type, 0u);
+        m_stored_levels = 1u;
+        m_match_level   = NO_MATCH;
+        m_paths[0u]     = m_filter.get_paths();
+        m_indexes[0u]   = 0u;
+    }
+
+    /** @brief Start a new value in the current object/array (called after set_name() for the members of an object) */
+    void start_value(uint8_t nesting_level) { m_value_level = nesting_level; }
+
+    /** @brief Set the name of the new value in the current object */
+    void set_name(json_size_t name_start, const std::string_view& name)
+    {
+        m_name_start = name_start;
+        m_name       = name;
+    }
+
+    /** @brief Add a null, boolean, string or number value to the current object/array */
+    void add_value(json_value_type type, json_size_t value_start, const std::string_view& value, bool ascii)
+    {
+        uint64_t paths = 0u;
+        if (select_value(paths) && ((m_match_level != NO_MATCH) || (m_filter.get_ending_paths(paths, m_value_level) != 0u)))
+        {
+            m_values.add_value(type, value_start, value, ascii);
+        }
+        m_types.add_value();
+    }
+
+    /** @brief Add an integer value already converted by the parser to the current object/array */
+    void add_integer_value(json_size_t value_start, const std::string_view& value, json_int_t)
+    {
+        add_value(json_value_type::integer, value_start, value, true);
+    }
+
+    /** @brief Add an object/array value to the current object/array, it becomes the current object/array */
+    void begin_compound_value(json_value_type type, json_size_t value_start, uint8_t nesting_level)
+    {
+        uint64_t paths = 0u;
+        if (select_value(paths))
+        {
+            // Stored as a parent of the selected values, or selected with all its values
+            m_values.begin_compound_value(type, value_start, nesting_level);
+            m_stored_levels = static_cast<uint8_t>(nesting_level + 1u);
+            if (m_match_level == NO_MATCH)
+            {
+                if (m_filter.get_ending_paths(paths, m_value_level) != 0u)
+                {
+                    m_match_level = nesting_level;
+                }
+                else
+                {
+                    m_paths[nesting_level]   = paths;
+                    m_indexes[nesting_level] = 0u;
+                }
+            }
+        }
+        m_types.push(type, nesting_level);
+    }
+
+    /** @brief End the current object/array, its parent becomes the current object/array */
+    void end_compound_value(uint8_t nesting_level, json_size_t value_end)
+    {
+        if (nesting_level < m_stored_levels)
+        {
+            m_values.end_compound_value(nesting_level, value_end);
+            m_stored_levels = nesting_level;
+            if (m_match_level == nesting_level)
+            {
+                m_match_level = NO_MATCH;
+            }
+        }
+        m_types.pop(nesting_level);
+    }
+
+    /** @brief Set the end marker after the last value */
+    void set_end_marker(bool complete) { m_values.set_end_marker(complete); }
+
+  private:
+    /** @brief Marker of no object/array selected with all its values */
+    static constexpr uint8_t NO_MATCH = 0xFFu;
+
+    /** @brief Descriptors of the stored values */
+    desc_value_handler m_values;
+    /** @brief Path filter */
+    const json_path_filter& m_filter;
+    /** @brief Types of the opened objects/arrays */
+    compound_types m_types;
+    /** @brief Number of opened objects/arrays which are stored */
+    uint8_t m_stored_levels;
+    /** @brief Nesting level of the object/array selected with all its values */
+    uint8_t m_match_level;
+    /** @brief Nesting level of the new value */
+    uint8_t m_value_level;
+    /** @brief Start of the name of the new value */
+    json_size_t m_name_start;
+    /** @brief Name of the new value */
+    std::string_view m_name;
+    /** @brief Paths matching the opened objects/arrays which are stored but not selected */
+    uint64_t m_paths[MAX_FILTER_PATH_DEPTH];
+    /** @brief Index of the next element of the opened arrays which are stored but not selected */
+    json_size_t m_indexes[MAX_FILTER_PATH_DEPTH];
+
+    /** @brief Check if the new value must be stored and start it in the descriptors,
+     *         paths contains the paths matching the value if its parent is not selected with all its values
+     */
+    bool select_value(uint64_t& paths)
+    {
+        bool          selected     = false;
+        const uint8_t parent_level = static_cast<uint8_t>(m_value_level - 1u);
+        if (parent_level < m_stored_levels)
+        {
+            if (m_match_level <= parent_level)
+            {
+                // Parent selected with all its values
+                selected = true;
+            }
+            else
+            {
+                // Compare the value position with the next component of the paths matching the parent
+                const bool is_member = (m_types.get_parent_type() == json_value_type::object);
+                paths                = m_filter.match(m_paths[parent_level], m_value_level, is_member, m_name, m_indexes[parent_level]);
+                selected             = (paths != 0u);
+                if (!is_member)
+                {
+                    m_indexes[parent_level]++;
+                }
+            }
+            if (selected)
+            {
+                m_values.start_value(m_value_level);
+                if (m_types.get_parent_type() == json_value_type::object)
+                {
+                    m_values.set_name(m_name_start, m_name);
+                }
+            }
+        }
+        return selected;
+    }
+};
+
+/** @brief Value handler of the json parser storing the parsed values in descriptors up to a maximum depth :
+ *         the objects/arrays beyond this depth are stored as a single unexpanded value covering their string representation
+ */
+class shallow_value_handler
+{
+  public:
+    /** @brief Constructor */
+    shallow_value_handler(const std::span<json_value_desc>& descriptors, uint8_t max_depth)
+        : m_values(descriptors), m_types(), m_max_depth(max_depth), m_unexpanded_level(NO_UNEXPANDED), m_unexpanded_start(0u)
+    {
+    }
+
+    /** @brief Forget the values of the previous json string */
+    void reset()
+    {
+        m_values.reset();
+        m_unexpanded_level = NO_UNEXPANDED;
+    }
+
+    /** @brief Check that at least 1 value can be parsed (root + end marker) */
+    bool can_start() const { return m_values.can_start(); }
+
+    /** @brief Indicate if the root object/array has been started */
+    bool is_started() const { return m_values.is_started(); }
+
+    /** @brief Indicate if no more memory is available to store a value */
+    bool is_full() const { return m_values.is_full(); }
+
+    /** @brief Get the type of the current object/array */
+    json_value_type get_parent_type() const { return m_types.get_parent_type(); }
+
+    /** @brief Indicate if no value has been added to the current object/array */
+    bool is_parent_empty() const { return m_types.is_parent_empty(); }
+
+    /** @brief Get the descriptor of the root object/array */
+    json_value_desc& get_root() { return m_values.get_root(); }
+
+    /** @brief Get the number of members/elements added to the root object/array */
+    json_size_t get_root_size() const { return m_values.get_root_size(); }
+
+    /** @brief Start the root object/array */
+    void start_root(json_value_type type, json_size_t value_start)
+    {
+        m_values.start_root(type, value_start);
+        m_types.push(type, 0u);
+    }
+
+    /** @brief Start a new value in the current object/array */
+    void start_value(uint8_t nesting_level)
+    {
+        if (m_unexpanded_level == NO_UNEXPANDED)
+        {
+            m_values.start_value(nesting_level);
+        }
+    }
+
+    /** @brief Set the name of the new value in the current object */
+    void set_name(json_size_t name_start, const std::string_view& name)
+    {
+        if (m_unexpanded_level == NO_UNEXPANDED)
+        {
+            m_values.set_name(name_start, name);
+        }
+    }
+
+    /** @brief Add a null, boolean, string or number value to the current object/array */
+    void add_value(json_value_type type, json_size_t value_start, const std::string_view& value, bool ascii)
+    {
+        if (m_unexpanded_level == NO_UNEXPANDED)
+        {
+            m_values.add_value(type, value_start, value, ascii);
+        }
+        m_types.add_value();
+    }
+
+    /** @brief Add an integer value already converted by the parser to the current object/array */
+    void add_integer_value(json_size_t value_start, const std::string_view& value, json_int_t)
+    {
+        add_value(json_value_type::integer, value_start, value, true);
+    }
+
+    /** @brief Add an object/array value to the current object/array, it becomes the current object/array */
+    void begin_compound_value(json_value_type type, json_size_t value_start, uint8_t nesting_level)
+    {
+        if (m_unexpanded_level == NO_UNEXPANDED)
+        {
+            if (nesting_level < m_max_depth)
+            {
+                m_values.begin_compound_value(type, value_start, nesting_level);
+            }
+            else
+            {
+                // Value start is the index following the opening bracket, its size will be known when it is closed
+                m_unexpanded_level = nesting_level;
+                m_unexpanded_start = static_cast<json_size_t>(value_start - 1u);
+                m_values.add_value(json_value_type::unexpanded, m_unexpanded_start, std::string_view(), true);
+            }
+        }
+        m_types.push(type, nesting_level);
+    }
+
+    /** @brief End the current object/array, its parent becomes the current object/array,
+     *         value_end is the index following its closing bracket
+     */
+    void end_compound_value(uint8_t nesting_level, json_size_t value_end)
+    {
+        if (m_unexpanded_level == NO_UNEXPANDED)
+        {
+            m_values.end_compound_value(nesting_level, value_end);
+        }
+        else if (m_unexpanded_level == nesting_level)
+        {
+            m_values.get_last_value().value_size = static_cast<json_size_t>(value_end - m_unexpanded_start);
+            m_unexpanded_level                   = NO_UNEXPANDED;
+        }
+        else
+        {
+            // Nested value of an unexpanded object/array
+        }
+        m_types.pop(nesting_level);
+    }
+
+    /** @brief Set the end marker after the last value */
+    void set_end_marker(bool complete) { m_values.set_end_marker(complete); }
+
+  private:
+    /** @brief Marker of no unexpanded object/array being parsed */
+    static constexpr uint8_t NO_UNEXPANDED = 0xFFu;
+
+    /** @brief Descriptors of the stored values */
+    desc_value_handler m_values;
+    /** @brief Types of the opened objects/arrays */
+    compound_types m_types;
+    /** @brief Nesting level of the first objects/arrays which are not expanded */
+    uint8_t m_max_depth;
+    /** @brief Nesting level of the unexpanded object/array being parsed */
+    uint8_t m_unexpanded_level;
+    /** @brief Start of the unexpanded object/array being parsed */
+    json_size_t m_unexpanded_start;
+};
+
+/** @brief Value handler of the json parser storing the parsed values in descriptors and converting each integer/decimal value
+ *         while its chars are still in cache : the binary values are stored in a numbers array parallel to the descriptors
+ */
+class number_value_handler
+{
+  public:
+    /** @brief Constructor */
+    number_value_handler(const std::span<json_value_desc>& descriptors, const std::span<json_number>& numbers)
+        : m_values(descriptors.first(std::min(descriptors.size(), numbers.size()))), m_numbers(numbers.data())
+    {
+    }
+
+    /** @brief Forget the values of the previous json string */
+    void reset() { m_values.reset(); }
+
+    /** @brief Check that at least 1 value can be parsed (root + end marker) */
+    bool can_start() const { return m_values.can_start(); }
+
+    /** @brief Indicate if the root object/array has been started */
+    bool is_started() const { return m_values.is_started(); }
+
+    /** @brief Indicate if no more memory is available to store a value */
+    bool is_full() const { return m_values.is_full(); }
+
+    /** @brief Get the type of the current object/array */
+    json_value_type get_parent_type() const { return m_values.get_parent_type(); }
+
+    /** @brief Indicate if no value has been added to the current object/array */
+    bool is_parent_empty() const { return m_values.is_parent_empty(); }
+
+    /** @brief Get the descriptor of the root object/array */
+    json_value_desc& get_root() { return m_values.get_root(); }
+
+    /** @brief Get the number of members/elements added to the root object/array */
+    json_size_t get_root_size() const { return m_values.get_root_size(); }
+
+    /** @brief Get the converted numbers */
+    json_number* get_numbers() { return m_numbers; }
+
+    /** @brief Start the root object/array */
+    void start_root(json_value_type type, json_size_t value_start) { m_values.start_root(type, value_start); }
+
+    /** @brief Start a new value in the current object/array */
+    void start_value(uint8_t nesting_level) { m_values.start_value(nesting_level); }
+
+    /** @brief Set the name of the new value in the current object */
+    void set_name(json_size_t name_start, const std::string_view& name) { m_values.set_name(name_start, name); }
+
+    /** @brief Add a null, boolean, string or number value to the current object/array */
+    void add_value(json_value_type type, json_size_t value_start, const std::string_view& value, bool ascii)
+    {
+        // The number has the same index as its descriptor
+        if (type == json_value_type::integer)
+        {
+            m_numbers[m_values.get_values_count()].integer = to_int(value);
+        }
+        else if (type == json_value_type::decimal)
+        {
+            m_numbers[m_values.get_values_count()].decimal = to_float(value);
+        }
+        else
+        {
+            // Not a number
+        }
+        m_values.add_value(type, value_start, value, ascii);
+    }
+
+    /** @brief Add an integer value already converted by the parser to the current object/array */
+    void add_integer_value(json_size_t value_start, const std::string_view& value, json_int_t integer)
+    {
+        m_numbers[m_values.get_values_count()].integer = integer;
+        m_values.add_value(json_value_type::integer, value_start, value, true);
+    }
+
+    /** @brief Add an object/array value to the current object/array, it becomes the current object/array */
+    void begin_compound_value(json_value_type type, json_size_t value_start, uint8_t nesting_level)
+    {
+        m_values.begin_compound_value(type, value_start, nesting_level);
+    }
+
+    /** @brief End the current object/array, its parent becomes the current object/array,
+     *         value_end is the index following its closing bracket
+     */
+    void end_compound_value(uint8_t nesting_level, json_size_t value_end) { m_values.end_compound_value(nesting_level, value_end); }
+
+    /** @brief Set the end marker after the last value */
+    void set_end_marker(bool complete) { m_values.set_end_marker(complete); }
+
+  private:
+    /** @brief Descriptors of the stored values */
+    desc_value_handler m_values;
+    /** @brief Converted numbers */
+    json_number* m_numbers;
+};
+
+/** @brief Json parser, reports the parse errors to an error handler of any callable type :
+ *         using a template parameter instead of a std::function allows the compiler to inline
+ *         the error handler, and to remove all the error reporting code with no_error_handler.
+ *         The parsed values are given to a value handler which either stores them in descriptors
+ *         or forwards them to a visitor
+ */
+template <typename ErrorHandler, typename ValueHandler>
+class json_parser
+{
+  public:
+    /** @brief Constructor */
+    json_parser(ErrorHandler& error_handler, ValueHandler& value_handler)
+        : m_error_handler(error_handler),
+          m_value_handler(value_handler),
+          m_state(parser_state::start_of_json),
+          m_nesting_level(0u),
+          m_max_nesting_level(MAX_NESTING_LEVEL),
+          m_more_chars(false),
+          m_trailing_chars(false),
+          m_suspended(false),
+          m_success(false),
+          m_string_ascii(true),
+          m_suspended_ascii(true),
+          m_suspended_ascii_code(true),
+          m_suspended_string(nullptr),
+          m_suspended_current(nullptr),
+          m_suspended_position(nullptr),
+          m_begin(nullptr),
+          m_end(nullptr),
+          m_current(nullptr)
+    {
+    }
+
+    /** @brief Parse a json string */
+    std::optional<json_value> parse(const std::string_view& json_string)
+    {
+        begin(json_string.data());
+        resume(json_string.size(), false);
+        return end(json_string);
+    }
+
+    /** @brief Limit the nesting level of the objects/arrays (the root object/array is at level 1 and is always allowed) */
+    void set_max_nesting_level(uint8_t max_nesting_level)
+    {
+        m_max_nesting_level = std::clamp<uint8_t>(max_nesting_level, 1u, MAX_NESTING_LEVEL);
+    }
+
+    /** @brief Start the parsing of a json string which will be available starting at the given position,
+     *         the chars following the root object/array are ignored if trailing chars are allowed
+     */
+    void begin(const char* json_string, bool trailing_chars = false)
+    {
+        m_state              = parser_state::start_of_json;
+        m_nesting_level      = 0u;
+        m_trailing_chars     = trailing_chars;
+        m_success            = true;
+        m_suspended_string   = nullptr;
+        m_suspended_current  = nullptr;
+        m_suspended_position = nullptr;
+        m_begin              = json_string;
+        m_end                = json_string;
+        m_current            = json_string;
+        m_value_handler.reset();
+    }
+
+    /** @brief Start the parsing of a part of a json string which begins just after a member/element separator of the root object/array,
+     *         the positions of the parsed values are relative to the start of the whole json string
+     */
+    void begin_part(const char* json_string, size_t part_start, json_value_type root_type)
+    {
+        begin(json_string);
+        m_current = json_string + part_start;
+        m_end     = m_current;
+        if (m_value_handler.can_start())
+        {
+            m_nesting_level = 1u;
+            m_state         = ((root_type == json_value_type::object) ? parser_state::start_of_member_name : parser_state::start_of_value);
+            m_value_handler.resume_root(root_type);
+        }
+        else
+        {
+            // Error : No memory available
+            notify_error(json_parse_error::not_enough_memory);
+            m_success = false;
+        }
+    }
+
+    /** @brief Resume the parsing with the chars available from the start of the json string,
+     *         if more chars can be received, the parsing is suspended at the start of the first incomplete token
+     */
+    bool resume(size_t size, bool more_chars)
+    {
+        m_end        = m_begin + size;
+        m_more_chars = more_chars;
+        m_suspended  = false;
+        if (m_success && (size > MAX_JSON_STRING_SIZE))
+        {
+            // Error : Json string too big
+            notify_error(json_parse_error::json_too_big);
+            m_success = false;
+        }
+
+        // Loop on available chars
+        while (m_success && !m_suspended && (m_state != parser_state::end_of_json))
+        {
+            const char* token_start = m_current;
+            switch (m_state)
+            {
+                case parser_state::start_of_json:
+                    m_success = parse_start_of_json();
+                    break;
+
+                case parser_state::start_of_member_name:
+                    m_success = parse_start_of_member_name();
+                    break;
+
+                case parser_state::member_name:
+                    m_success = parse_member_name();
+                    break;
+
+                case parser_state::value_separator:
+                    m_success = parse_value_separator();
+                    break;
+
+                case parser_state::start_of_value:
+                    m_success = parse_start_of_value();
+                    break;
+
+                default:
+                    m_success = parse_member_separator();
+                    break;
+            }
+
+            if (m_suspended)
+            {
+                // Incomplete token, it will be parsed again when more chars are available (the search of a string resumes where it stopped)
+                m_current = token_start;
+                m_success = true;
+            }
+            else if (m_value_handler.is_full())
+            {
+                // Error : No more memory available
+                notify_error(json_parse_error::not_enough_memory);
+                m_success = false;
+            }
+        }
+
+        // End marker after the values parsed so far so that they can already be browsed
+        if (m_success && m_value_handler.is_started())
+        {
+            m_value_handler.set_end_marker(false);
+        }
+
+        // Check trailing chars
+        if (m_success && !m_trailing_chars && (m_state == parser_state::end_of_json) && (skip_blank_chars() != m_end))
+        {
+            // Error : Trailing chars
+            notify_error(json_parse_error::trailing_chars);
+            m_success = false;
+        }
+
+        return m_success;
+    }
+
+    /** @brief End the parsing of the json string, the root value is returned if the parsing is successful and complete */
+    std::optional<json_value> end(const std::string_view& json_string)
+    {
+        std::optional<json_value> root;
+
+        if (is_complete())
+        {
+            // Return json value corresponding to the root
+            root = json_value(json_string, m_value_handler.get_root());
+
+            // Set last descriptor to known values
+            m_value_handler.set_end_marker(true);
+        }
+
+        return root;
+    }
+
+    /** @brief Abort the parsing and report an error located at the end of the available chars */
+    void abort(json_parse_error error)
+    {
+        if (m_success)
+        {
+            m_current = m_end;
+            notify_error(error);
+            m_success = false;
+        }
+    }
+
+    /** @brief Indicate if no error has been detected */
+    bool is_successful() const { return m_success; }
+
+    /** @brief Indicate if the whole json string has been successfully parsed */
+    bool is_complete() const { return (m_success && (m_state == parser_state::end_of_json)); }
+
+    /** @brief Indicate if the parsing has stopped at the end of the available chars just after a member/element separator of the root object/array */
+    bool is_at_root_separator() const
+    {
+        return (m_success && (m_nesting_level == 1u) && (m_current == m_end) &&
+                (m_state == ((m_value_handler.get_parent_type() == json_value_type::object) ? parser_state::start_of_member_name
+                                                                                             : parser_state::start_of_value)));
+    }
+
+    /** @brief Get the number of chars parsed from the start of the json string */
+    json_size_t get_parsed_size() const { return get_index(m_current); }
+
+    /** @brief Get the number of members/elements of the root object/array which have been completely parsed */
+    json_size_t get_completed_count() const
+    {
+        json_size_t count = 0u;
+        if (m_value_handler.is_started())
+        {
+            // The member/element being parsed is already counted if it is an object/array
+            count = m_value_handler.get_root_size();
+            if (m_nesting_level > 1u)
+            {
+                count--;
+            }
+        }
+        return count;
+    }
+
+  private:
+    /** @brief Get the index of a position in the json string */
+    json_size_t get_index(const char* position) const
+    {
+        return static_cast<json_size_t>(position - m_begin);
+    }
+
+    /** @brief Notify an error located at the current position (+ offset) in the json string */
+    void notify_error(json_parse_error error, json_size_t offset = 0u)
+    {
+        if constexpr (!std::is_same_v<std::remove_cv_t<ErrorHandler>, no_error_handler>)
+        {
+            m_error_handler(static_cast<json_size_t>(get_index(m_current) + offset), error);
+        }
+        else
+        {
+            (void)error;
+            (void)offset;
+        }
+    }
+
+    /** @brief Suspend the parsing at the end of the available chars if more chars can be received */
+    bool suspend()
+    {
+        m_suspended = m_more_chars;
+        return m_suspended;
+    }
+
+    /** @brief Get the position of the next char which is not a blank char starting from the current position (end of string if not found) */
+    const char* skip_blank_chars()
+    {
+        const char* position = m_current;
+        if ((position != m_end) && (get_char_class(*position) == char_class::blank))
+        {
+            do
+            {
+                position++;
+            } while ((position != m_end) && (get_char_class(*position) == char_class::blank));
+        }
+        return position;
+    }
+
+    /** @brief Get the position of the next '"' or '\\' char starting from the given position (end of string if not found),
+     *         ascii is cleared if non ASCII chars may be found before this position
+     */
+    const char* find_string_char(const char* position, bool& ascii)
+    {
+#if defined(NANOJSONCPP_USE_SIMD_SCAN) && defined(NANOJSONCPP_USE_UTF8_VALIDATION)
+        return nanojsoncpp::find_string_char(position, m_end, ascii);
+#elif defined(NANOJSONCPP_USE_SIMD_SCAN)
+        (void)ascii;
+        return nanojsoncpp::find_string_char(position, m_end);
+#else
+        // The chars are checked afterwards by check_utf8_chars()
+        ascii = false;
+        while (position != m_end)
+        {
+            const char_class c_class = get_char_class(*position);
+            if ((c_class == char_class::quote) || (c_class == char_class::backslash))
+            {
+                break;
+            }
+            position++;
+        }
+        return position;
+#endif // NANOJSONCPP_USE_SIMD_SCAN
+    }
+
+    /** @brief Check the UTF-8 sequences of the chars of a string if non ASCII chars have been found while searching its end,
+     *         the current position is set to the first invalid sequence if any
+     */
+    bool check_utf8_chars(const char* str_start, const char* str_end, bool ascii)
+    {
+#ifdef NANOJSONCPP_USE_UTF8_VALIDATION
+        bool valid     = true;
+        m_string_ascii = ascii;
+        if (!ascii)
+        {
+            const char* invalid = find_invalid_utf8(str_start, str_end, m_string_ascii);
+            if (invalid != str_end)
+            {
+                m_current = invalid;
+                valid     = false;
+            }
+        }
+        return valid;
+#else
+        (void)str_start;
+        (void)str_end;
+        (void)ascii;
+        return true;
+#endif // NANOJSONCPP_USE_UTF8_VALIDATION
+    }
+
+    /** @brief Check a \\uXXXX escaped char starting at the given position, a high surrogate must be followed by an escaped low surrogate :
+     *         the current position is set after the escaped char if it is valid, ascii is cleared if its code is not an ASCII char
+     */
+    json_parse_error check_unicode_escape(const char* escape, bool& ascii)
+    {
+        uint32_t         code  = 0u;
+        size_t           size  = 6u;
+        json_parse_error error = get_unicode_escape(escape, code);
+        if ((error == json_parse_error::no_error) && (code >= 0xD800u) && (code <= 0xDBFFu))
+        {
+            // High surrogate
+            uint32_t low_surrogate = 0u;
+            error                  = get_unicode_escape(escape + 6u, low_surrogate);
+            if ((error == json_parse_error::no_error) && ((low_surrogate < 0xDC00u) || (low_surrogate > 0xDFFFu)))
+            {
+                // Error: not a low surrogate
+                error = json_parse_error::invalid_escaped_char;
+            }
+            size = 12u;
+        }
+        else if ((error == json_parse_error::no_error) && (code >= 0xDC00u) && (code <= 0xDFFFu))
+        {
+            // Error: low surrogate without high surrogate
+            error = json_parse_error::invalid_escaped_char;
+        }
+        if (error == json_parse_error::no_error)
+        {
+            m_current = escape + size;
+            ascii     = (ascii && (code < 0x80u));
+        }
+        return error;
+    }
+
+    /** @brief Get the code of a \\uXXXX escaped char starting at the given position,
+     *         returns missing_end_of_string if the available chars are the start of a valid escaped char
+     */
+    json_parse_error get_unicode_escape(const char* escape, uint32_t& code) const
+    {
+        static constexpr size_t UNICODE_ESCAPE_SIZE = 6u;
+
+        json_parse_error error = json_parse_error::no_error;
+        const size_t     size  = std::min<size_t>(UNICODE_ESCAPE_SIZE, static_cast<size_t>(m_end - escape));
+        code                   = 0u;
+        for (size_t i = 0u; (i < size) && (error == json_parse_error::no_error); i++)
+        {
+            bool valid = false;
+            if (i == 0u)
+            {
+                valid = (escape[i] == '\\');
+            }
+            else if (i == 1u)
+            {
+                valid = (escape[i] == 'u');
+            }
+            else
+            {
+                const uint8_t digit = get_hex_digit(escape[i]);
+                code                = ((code << 4u) | digit);
+                valid               = (digit < 16u);
+            }
+            if (!valid)
+            {
+                // Error: invalid escaped char
+                error = json_parse_error::invalid_escaped_char;
+            }
+        }
+        if ((error == json_parse_error::no_error) && (size != UNICODE_ESCAPE_SIZE))
+        {
+            // Error: incomplete escaped char
+            error = json_parse_error::missing_end_of_string;
+        }
+        return error;
+    }
+
+    /** @brief Get a string value starting at the current position,
+     *         the search of a string suspended because of missing chars resumes where it has stopped
+     */
+    bool get_string_value(std::string_view& str_value)
+    {
+        bool             success    = false;
+        bool             end_of_str = false;
+        const char*      str_start  = m_current;
+        const char*      next       = m_current;
+        bool             ascii      = true;
+        bool             ascii_code = true;
+        json_parse_error error      = json_parse_error::no_error;
+        if (m_suspended_string == str_start)
+        {
+            // Chars already checked before the suspension
+            m_current  = m_suspended_current;
+            next       = m_suspended_position;
+            ascii      = m_suspended_ascii;
+            ascii_code = m_suspended_ascii_code;
+        }
+        m_suspended_string = nullptr;
+        while (!end_of_str)
+        {
+            next = find_string_char(next, ascii);
+            if (next != m_end)
+            {
+                if (*next == '"')
+                {
+                    // End of string
+                    end_of_str = true;
+                    if (check_utf8_chars(str_start, next, ascii))
+                    {
+                        str_value      = std::string_view(str_start, static_cast<size_t>(next - str_start));
+                        m_current      = next + 1u;
+                        m_string_ascii = (m_string_ascii && ascii_code);
+                        success        = true;
+                    }
+                    else
+                    {
+                        // Error: invalid UTF-8 sequence
+                        error = json_parse_error::invalid_utf8_char;
+                    }
+                }
+                else
+                {
+                    // Escaped char
+                    m_current = next;
+                    if ((next + 1u) != m_end)
+                    {
+                        // Check validity
+                        switch (next[1u])
+                        {
+                            case '\\':
+                            case '/':
+                            case '"':
+                            case 'n':
+                            case 'r':
+                            case 'b':
+                            case 'f':
+                            case 't':
+                                // Valid escaped char
+                                m_current = next + 2u;
+                                break;
+
+                            case 'u':
+                                // Unicode escaped char
+                                error      = check_unicode_escape(next, ascii_code);
+                                end_of_str = (error != json_parse_error::no_error);
+                                break;
+
+                            default:
+                                // Invalid escaped char
+                                error      = json_parse_error::invalid_escaped_char;
+                                end_of_str = true;
+                                break;
+                        }
+                    }
+                    else
+                    {
+                        // Error: missing end of string
+                        error      = json_parse_error::missing_end_of_string;
+                        end_of_str = true;
+                    }
+                    next = m_current;
+                }
+            }
+            else
+            {
+                // Error: missing end of string
+                error      = json_parse_error::missing_end_of_string;
+                end_of_str = true;
+            }
+        }
+
+        if (!success)
+        {
+            if ((error == json_parse_error::missing_end_of_string) && suspend())
+            {
+                // Keep the search state to resume it from the end of the available chars or the incomplete escaped char
+                m_suspended_string     = str_start;
+                m_suspended_current    = m_current;
+                m_suspended_position   = next;
+                m_suspended_ascii      = ascii;
+                m_suspended_ascii_code = ascii_code;
+            }
+            else
+            {
+                notify_error(error);
+            }
+        }
+
+        return success;
+    }
+
+    /** @brief Parse the start of the json string */
+    bool parse_start_of_json()
+    {
+        bool success = false;
+
+        // Check that we can at least parse 1 value (root + end marker)
+        if (m_value_handler.can_start())
+        {
+            // json string is either an object or an array
+            const char* root_start = skip_blank_chars();
+            if (root_start != m_end)
+            {
+                // Initialize parser context
+                m_nesting_level = 1u;
+                m_current       = root_start + 1u;
+
+                // Initialize root node
+                switch (get_char_class(*root_start))
+                {
+                    case char_class::begin_object:
+                        m_value_handler.start_root(json_value_type::object, get_index(root_start));
+                        m_state = parser_state::start_of_member_name;
+                        success = true;
+                        break;
+
+                    case char_class::begin_array:
+                        m_value_handler.start_root(json_value_type::array, get_index(root_start));
+                        m_state = parser_state::start_of_value;
+                        success = true;
+                        break;
+
+                    default:
+                        // Error : Invalid json string
+                        notify_error(json_parse_error::not_a_json_string);
+                        break;
+                }
+            }
+            else if (!suspend())
+            {
+                // Error : Invalid json string
+                m_current = m_begin;
+                notify_error(json_parse_error::not_a_json_string);
+            }
+        }
+        else
+        {
+            // Error : No memory available
+            notify_error(json_parse_error::not_enough_memory);
+        }
+
+        return success;
+    }
+
+    /** @brief Parse the start of an object's member name */
+    bool parse_start_of_member_name()
+    {
+        bool success = false;
+
+        // Look for either a new member name or the end of the object
+        const char* next = skip_blank_chars();
+        if (next != m_end)
+        {
+            m_current = next + 1u;
+            switch (get_char_class(*next))
+            {
+                case char_class::end_object:
+                {
+                    // End of object, check if the object is empty
+                    if (m_value_handler.is_parent_empty())
+                    {
+                        finalize_compound_value();
+                        success = true;
+                    }
+                    else
+                    {
+                        // Error : Expected member name
+                        notify_error(json_parse_error::expected_member_name);
+                    }
+                }
+                break;
+
+                case char_class::quote:
+                {
+                    // Next state
+                    m_state = parser_state::member_name;
+                    success = true;
+                }
+                break;
+
+                default:
+                {
+                    // Error : Unexpected char
+                    notify_error(json_parse_error::unexpected_char);
+                }
+                break;
+            }
+        }
+        else if (!suspend())
+        {
+            // Error : Unexpected end of json string
+            m_current = m_end;
+            notify_error(json_parse_error::unexpected_end_of_json_string, 1u);
+        }
+
+        return success;
+    }
+
+    /** @brief Parse the name of an object's member */
+    bool parse_member_name()
+    {
+        bool success = false;
+
+        // Extract member name
+        const char*      start_of_name = m_current;
+        std::string_view name;
+        if (get_string_value(name))
+        {
+            // Save position
+            m_value_handler.set_name(get_index(start_of_name), name);
+
+            // Next state
+            m_state = parser_state::value_separator;
+            success = true;
+        }
+
+        return success;
+    }
+
+    /** @brief Parse a value separator of an object's member */
+    bool parse_value_separator()
+    {
+        bool success = false;
+
+        // Look for the value separator
+        const char* next = skip_blank_chars();
+        if ((next != m_end) && (get_char_class(*next) == char_class::name_separator))
+        {
+            // Next state
+            m_current = next + 1u;
+            m_state   = parser_state::start_of_value;
+            success   = true;
+        }
+        else if ((next != m_end) || !suspend())
+        {
+            // Error : Missing value separator
+            m_current = next;
+            notify_error(json_parse_error::missing_value_separator, 1u);
+        }
+        return success;
+    }
+
+    /** @brief Parse the start of a json value */
+    bool parse_start_of_value()
+    {
+        bool success = false;
+
+        // Start the new value
+        m_value_handler.start_value(m_nesting_level);
+
+        // Look for the value start
+        const char* blanks_start = m_current;
+        m_current                = skip_blank_chars();
+        if (m_current != m_end)
+        {
+            // Next state
+            switch (get_char_class(*m_current))
+            {
+                case char_class::null_literal:
+                {
+                    // Null value
+                    success = parse_litteral_const_value(std::string_view("null"), json_value_type::null);
+                }
+                break;
+
+                case char_class::true_literal:
+                {
+                    // Boolean true value
+                    success = parse_litteral_const_value(std::string_view("true"), json_value_type::boolean);
+                }
+                break;
+
+                case char_class::false_literal:
+                {
+                    // Boolean false value
+                    success = parse_litteral_const_value(std::string_view("false"), json_value_type::boolean);
+                }
+                break;
+
+                case char_class::quote:
+                {
+                    // String value
+                    success = parse_string_value();
+                }
+                break;
+
+                case char_class::begin_array:
+                {
+                    // Array value
+                    success = parse_compound_value(json_value_type::array, parser_state::start_of_value);
+                }
+                break;
+
+                case char_class::begin_object:
+                {
+                    // Object value
+                    success = parse_compound_value(json_value_type::object, parser_state::start_of_member_name);
+                }
+                break;
+
+                case char_class::end_array:
+                {
+                    // End of array, only allowed on empty array
+                    if ((m_value_handler.get_parent_type() == json_value_type::array) && m_value_handler.is_parent_empty())
+                    {
+                        m_current++;
+                        finalize_compound_value();
+                        success = true;
+                    }
+                    else
+                    {
+                        // Error : Unexpected char (reported after the blank chars which follow the previous value separator)
+                        notify_error(json_parse_error::unexpected_char, get_index(m_current) - get_index(blanks_start));
+                    }
+                }
+                break;
+
+                case char_class::digit:
+                case char_class::minus:
+                {
+                    // Decimal value
+                    success = parse_decimal_value();
+                }
+                break;
+
+                default:
+                {
+                    // Error : invalid value
+                    notify_error(json_parse_error::invalid_value);
+                }
+                break;
+            }
+        }
+        else if (!suspend())
+        {
+            // Error : unexpected end of json string
+            notify_error(json_parse_error::unexpected_end_of_json_string);
+        }
+
+        return success;
+    }
+
+    /** @brief Parse a member separator of an object */
+    bool parse_member_separator()
+    {
+        bool success = false;
+
+        // Look for the member separator
+        const char* next = skip_blank_chars();
+        if (next != m_end)
+        {
+            m_current = next + 1u;
+            success   = true;
+            switch (get_char_class(*next))
+            {
+                case char_class::value_separator:
+                {
+                    // Next state
+                    if (m_value_handler.get_parent_type() == json_value_type::array)
+                    {
+                        m_state = parser_state::start_of_value;
+                    }
+                    else
+                    {
+                        m_state = parser_state::start_of_member_name;
+                    }
+                }
+                break;
+
+                case char_class::end_object:
+                case char_class::end_array:
+                {
+                    if (m_value_handler.get_parent_type() ==
+                        ((get_char_class(*next) == char_class::end_object) ? json_value_type::object : json_value_type::array))
+                    {
+                        // End of object or array
+                        finalize_compound_value();
+                    }
+                    else
+                    {
+                        // Error: Unexpected char
+                        notify_error(json_parse_error::unexpected_char);
+                        success = false;
+                    }
+                }
+                break;
+
+                default:
+                {
+                    // Error: Unexpected char
+                    notify_error(json_parse_error::unexpected_char);
+                    success = false;
+                }
+                break;
+            }
+        }
+        else if (!suspend())
+        {
+            // Error: Unexpected end of json string
+            m_current = m_end;
+            notify_error(json_parse_error::unexpected_end_of_json_string, 1u);
+        }
+
+        return success;
+    }
+
+    /** @brief Parse a litteral constant value */
+    bool parse_litteral_const_value(const std::string_view& expected_value, json_value_type type)
+    {
+        bool success = false;
+
+        if (static_cast<size_t>(m_end - m_current) > expected_value.size())
+        {
+            if (std::string_view(m_current, expected_value.size()) == expected_value)
+            {
+                // Save value
+                m_value_handler.add_value(type, get_index(m_current), expected_value, true);
+
+                // Next state
+                m_current += expected_value.size();
+                m_state = parser_state::member_separator;
+
+                success = true;
+            }
+        }
+        else
+        {
+            // Wait for the end of the value if more chars can be received
+            success = suspend();
+        }
+        if (!success)
+        {
+            // Error : invalid value
+            notify_error(json_parse_error::invalid_value);
+        }
+
+        return success;
+    }
+
+    /** @brief Parse a string value */
+    bool parse_string_value()
+    {
+        bool success = false;
+
+        const char* start_of_string = m_current + 1u;
+        if (start_of_string != m_end)
+        {
+            std::string_view value;
+            m_current = start_of_string;
+            if (get_string_value(value))
+            {
+                // Save position
+                m_value_handler.add_value(json_value_type::string, get_index(start_of_string), value, m_string_ascii);
+
+                // Next state
+                m_state = parser_state::member_separator;
+
+                success = true;
+            }
+        }
+        else if (!suspend())
+        {
+            // Error: missing end of string
+            notify_error(json_parse_error::missing_end_of_string);
+        }
+
+        return success;
+    }
+
+    /** @brief Parse a decimal value */
+    bool parse_decimal_value()
+    {
+        // Maximum number of digits of an integer value which can't overflow json_int_t
+        static constexpr size_t MAX_INTEGER_DIGITS = static_cast<size_t>(std::numeric_limits<json_int_t>::digits10);
+
+        bool success = false;
+
+        // Skip sign
+        const char* start_of_digits = m_current;
+        if (*start_of_digits == '-')
+        {
+            start_of_digits++;
+        }
+
+        // Convert the leading digits 8 at a time, they are the whole value of an integer
+        uint64_t    digits_value = 0u;
+        const char* next         = parse_digits(start_of_digits, m_end, digits_value);
+
+        // Look for the end of the value and check chars validity
+        bool        is_integer   = true;
+        bool        valid_chars  = true;
+        bool        end_of_value = false;
+        const char* exponent     = nullptr;
+        while (!end_of_value && (next != m_end))
+        {
+            switch (get_char_class(*next))
+            {
+                case char_class::digit:
+                    break;
+
+                case char_class::decimal_point:
+                {
+                    if (is_integer)
+                    {
+                        is_integer = false;
+                    }
+                    else
+                    {
+                        // '.' is present more than once in the value or is in the exponent
+                        valid_chars = false;
+                    }
+                }
+                break;
+
+                case char_class::exponent:
+                {
+                    if ((exponent == nullptr) && (next != start_of_digits))
+                    {
+                        exponent   = next;
+                        is_integer = false;
+                    }
+                    else
+                    {
+                        // Exponent is present more than once in the value or has no digits before it
+                        valid_chars = false;
+                    }
+                }
+                break;
+
+                case char_class::minus:
+                case char_class::plus:
+                {
+                    if ((exponent == nullptr) || (next != (exponent + 1u)))
+                    {
+                        // Sign is present more than once in the value or is not at the start of the exponent
+                        valid_chars = false;
+                    }
+                }
+                break;
+
+                default:
+                {
+                    end_of_value = true;
+                }
+                break;
+            }
+            if (!end_of_value)
+            {
+                next++;
+            }
+        }
+        if ((exponent != nullptr) && (get_char_class(*(next - 1u)) != char_class::digit))
+        {
+            // Exponent without digits
+            valid_chars = false;
+        }
+        if (end_of_value && valid_chars && (next != start_of_digits))
+        {
+            // Save position, the integers which can't overflow are given already converted
+            const std::string_view value(m_current, static_cast<size_t>(next - m_current));
+            if (is_integer && (static_cast<size_t>(next - start_of_digits) <= MAX_INTEGER_DIGITS))
+            {
+                const json_int_t integer = static_cast<json_int_t>(digits_value);
+                m_value_handler.add_integer_value(get_index(m_current), value, ((start_of_digits != m_current) ? -integer : integer));
+            }
+            else
+            {
+                m_value_handler.add_value((is_integer ? json_value_type::integer : json_value_type::decimal), get_index(m_current), value, true);
+            }
+
+            // Next state
+            m_current = next;
+            m_state   = parser_state::member_separator;
+
+            success = true;
+        }
+        else if (end_of_value || !suspend())
+        {
+            // Error: invalid value
+            notify_error(json_parse_error::invalid_value);
+        }
+
+        return success;
+    }
+
+    /** @brief Parse a compound value (object or array) */
+    bool parse_compound_value(json_value_type type, parser_state next_state)
+    {
+        bool success = false;
+
+        // Check nesting level
+        if (m_nesting_level != m_max_nesting_level)
+        {
+            // Save position
+            m_current++;
+            m_value_handler.begin_compound_value(type, get_index(m_current), m_nesting_level);
+
+            // Next state
+            m_nesting_level++;
+            m_state = next_state;
+
+            success = true;
+        }
+        else
+        {
+            // Error: Maximum nesting level
+            notify_error(json_parse_error::max_nesting_level);
+        }
+
+        return success;
+    }
+
+    /** @brief Finalize a compound value parsing */
+    void finalize_compound_value()
+    {
+        // Decrease nesting level
+        m_nesting_level--;
+
+        // Update parent
+        m_value_handler.end_compound_value(m_nesting_level, get_index(m_current));
+        if (m_nesting_level != 0u)
+        {
+            // Next state
+            m_state = parser_state::member_separator;
+        }
+        else
+        {
+            // End of the root object/array
+            m_state = parser_state::end_of_json;
+        }
+    }
+
+    /** @brief Error handler */
+    ErrorHandler& m_error_handler;
+    /** @brief Value handler */
+    ValueHandler& m_value_handler;
+    /** @brief Current state */
+    parser_state m_state;
+    /** @brief Current nesting level */
+    uint8_t m_nesting_level;
+    /** @brief Maximum nesting level */
+    uint8_t m_max_nesting_level;
+    /** @brief Indicate if more chars can be received after the available ones */
+    bool m_more_chars;
+    /** @brief Indicate if chars are allowed after the root object/array */
+    bool m_trailing_chars;
+    /** @brief Indicate if the parsing has been suspended because of an incomplete token */
+    bool m_suspended;
+    /** @brief Indicate if no error has been detected */
+    bool m_success;
+    /** @brief Indicate if the last parsed string only contains ASCII chars */
+    bool m_string_ascii;
+    /** @brief Indicate if no non ASCII chars have been found in the suspended string */
+    bool m_suspended_ascii;
+    /** @brief Indicate if no non ASCII escaped chars have been found in the suspended string */
+    bool m_suspended_ascii_code;
+    /** @brief Start of the string whose search has been suspended (nullptr if none) */
+    const char* m_suspended_string;
+    /** @brief Current position in the suspended string (after its last escaped char) */
+    const char* m_suspended_current;
+    /** @brief Position where the search of the suspended string resumes */
+    const char* m_suspended_position;
+    /** @brief Start of the json string */
+    const char* m_begin;
+    /** @brief End of the json string */
+    const char* m_end;
+    /** @brief Current position in the json string */
+    const char* m_current;
+};
+
+/** @brief Parse a json string and report the errors to an error handler of any callable type */
+template <typename ErrorHandler, std::enable_if_t<std::is_invocable_v<ErrorHandler&, json_size_t, json_parse_error>, bool>>
+std::optional<json_value> parse(const std::string_view& json_string, const std::span<json_value_desc>& descriptors, ErrorHandler&& error_handler)
+{
+    desc_value_handler                                                     value_handler(descriptors);
+    json_parser<std::remove_reference_t<ErrorHandler>, desc_value_handler> parser(error_handler, value_handler);
+    return parser.parse(json_string);
+}
+
+/** @brief Parse a json string and convert each integer/decimal value once in a numbers array parallel to the descriptors,
+ *         report the errors to an error handler of any callable type
+ */
+template <typename ErrorHandler, std::enable_if_t<std::is_invocable_v<ErrorHandler&, json_size_t, json_parse_error>, bool>>
+std::optional<json_value> parse(const std::string_view&           json_string,
+                                const std::span<json_value_desc>& descriptors,
+                                const std::span<json_number>&     numbers,
+                                ErrorHandler&&                    error_handler)
+{
+    number_value_handler                                                     value_handler(descriptors, numbers);
+    json_parser<std::remove_reference_t<ErrorHandler>, number_value_handler> parser(error_handler, value_handler);
+    std::optional<json_value>                                                root = parser.parse(json_string);
+    if (root)
+    {
+        root = json_value(json_string, value_handler.get_root(), value_handler.get_numbers());
+    }
+    return root;
+}
+
+/** @brief Parse a json string and only store the values selected by a path filter, report the errors to an error handler of any callable type */
+template <typename ErrorHandler, std::enable_if_t<std::is_invocable_v<ErrorHandler&, json_size_t, json_parse_error>, bool>>
+std::optional<json_value> parse(const std::string_view&           json_string,
+                                const std::span<json_value_desc>& descriptors,
+                                const json_path_filter&           filter,
+                                ErrorHandler&&                    error_handler)
+{
+    std::optional<json_value> root;
+    if (filter.is_valid())
+    {
+        filter_value_handler                                                     value_handler(descriptors, filter);
+        json_parser<std::remove_reference_t<ErrorHandler>, filter_value_handler> parser(error_handler, value_handler);
+        root = parser.parse(json_string);
+    }
+    return root;
+}
+
+/** @brief Parse a json string up to a maximum depth, report the errors to an error handler of any callable type */
+template <typename ErrorHandler, std::enable_if_t<std::is_invocable_v<ErrorHandler&, json_size_t, json_parse_error>, bool>>
+std::optional<json_value> parse(const std::string_view&           json_string,
+                                const std::span<json_value_desc>& descriptors,
+                                uint8_t                           max_depth,
+                                ErrorHandler&&                    error_handler)
+{
+    shallow_value_handler                                                     value_handler(descriptors, max_depth);
+    json_parser<std::remove_reference_t<ErrorHandler>, shallow_value_handler> parser(error_handler, value_handler);
+    return parser.parse(json_string);
+}
+
+/** @brief Parse a json string and forward the parsed values to a visitor, report the errors to an error handler of any callable type */
+template <typename Visitor,
+          typename ErrorHandler,
+          std::enable_if_t<std::is_invocable_v<ErrorHandler&, json_size_t, json_parse_error>, bool>>
+bool parse_events(const std::string_view& json_string, Visitor& visitor, ErrorHandler&& error_handler)
+{
+    visitor_value_handler<Visitor>                                                     value_handler(visitor);
+    json_parser<std::remove_reference_t<ErrorHandler>, visitor_value_handler<Visitor>> parser(error_handler, value_handler);
+    parser.begin(json_string.data());
+    parser.resume(json_string.size(), false);
+    return parser.is_complete();
+}
+
+/** @brief Count the descriptors needed to parse a json string, report the errors to an error handler of any callable type */
+template <typename ErrorHandler, std::enable_if_t<std::is_invocable_v<ErrorHandler&, json_size_t, json_parse_error>, bool>>
+std::optional<json_count> parse_count(const std::string_view& json_string, ErrorHandler&& error_handler)
+{
+    std::optional<json_count>                                               count;
+    count_value_handler                                                     value_handler;
+    json_parser<std::remove_reference_t<ErrorHandler>, count_value_handler> parser(error_handler, value_handler);
+    parser.begin(json_string.data());
+    if (parser.resume(json_string.size(), false))
+    {
+        count = value_handler.get_count();
+    }
+    return count;
+}
+
+/** @brief Validate a json string up to a maximum depth, report the errors to an error handler of any callable type */
+template <typename ErrorHandler, std::enable_if_t<std::is_invocable_v<ErrorHandler&, json_size_t, json_parse_error>, bool>>
+bool validate(const std::string_view& json_string, uint8_t max_depth, ErrorHandler&& error_handler)
+{
+    validate_value_handler                                                     value_handler;
+    json_parser<std::remove_reference_t<ErrorHandler>, validate_value_handler> parser(error_handler, value_handler);
+    parser.set_max_nesting_level(max_depth);
+    parser.begin(json_string.data());
+    return parser.resume(json_string.size(), false);
+}
+
+} // namespace nanojsoncpp
+
+#endif // NANOJSONCPP_PARSER_H
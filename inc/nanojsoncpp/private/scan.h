@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2025 c-jimenez
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef NANOJSONCPP_SCAN_H
+#define NANOJSONCPP_SCAN_H
+
+// Standard headers
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif // defined(__SSE2__)
+
+namespace nanojsoncpp
+{
+
+/** @brief Size in bytes of a block of json string classified at once */
+constexpr size_t SCAN_BLOCK_SIZE = 64u;
+
+/** @brief Instruction sets which can be used to classify the chars of a json string */
+enum class scan_isa : uint8_t
+{
+    /** @brief Portable C++ code */
+    scalar,
+    /** @brief x86 SSE2 instructions */
+    sse2,
+    /** @brief x86 AVX2 instructions */
+    avx2
+};
+
+/** @brief Classification of the chars of a block of json string : bit N of each mask corresponds to the char N of the block */
+struct scan_block_masks
+{
+    /** @brief '"' chars */
+    uint64_t quotes;
+    /** @brief '\\' chars */
+    uint64_t backslashes;
+    /** @brief '{', '}', '[', ']', ':' and ',' chars */
+    uint64_t structurals;
+    /** @brief ' ', '\\t', '\\r' and '\\n' chars */
+    uint64_t blanks;
+};
+
+/** @brief Block classification function */
+using scan_block_func_t = scan_block_masks (*)(const char* block);
+
+/** @brief Get the most efficient instruction set available on the running CPU */
+scan_isa get_scan_isa();
+
+/** @brief Get the block classification function corresponding to an instruction set (fallback to scalar if not available) */
+scan_block_func_t get_scan_block_func(scan_isa isa);
+
+/** @brief Classify the SCAN_BLOCK_SIZE chars of a block of json string using the most efficient instruction set available */
+scan_block_masks scan_block(const char* block);
+
+/** @brief Get the number of trailing zero bits of a non null 64 bits value */
+inline unsigned int count_trailing_zeros(uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned int>(__builtin_ctzll(value));
+#else
+    unsigned int count = 0u;
+    while ((value & 1u) == 0u)
+    {
+        value >>= 1u;
+        count++;
+    }
+    return count;
+#endif
+}
+
+/** @brief Get the quotes of a block which are not escaped by a backslash,
+ *         escaped is set when the last char of the block escapes the first char of the next block
+ */
+inline uint64_t get_unescaped_quotes(const scan_block_masks& masks, bool& escaped)
+{
+    uint64_t quotes = masks.quotes;
+    if (escaped || (masks.backslashes != 0u))
+    {
+        uint64_t escaped_chars = (escaped ? 1u : 0u);
+        uint64_t backslashes   = (masks.backslashes & ~escaped_chars);
+        escaped                = false;
+        while (backslashes != 0u)
+        {
+            const unsigned int backslash = count_trailing_zeros(backslashes);
+            if (backslash == (SCAN_BLOCK_SIZE - 1u))
+            {
+                escaped     = true;
+                backslashes = 0u;
+            }
+            else
+            {
+                escaped_chars |= (static_cast<uint64_t>(2u) << backslash);
+                backslashes &= ~(static_cast<uint64_t>(3u) << backslash);
+            }
+        }
+        quotes &= ~escaped_chars;
+    }
+    return quotes;
+}
+
+/** @brief Get the chars of a block which are inside a string (opening quotes included) using a prefix xor of its unescaped quotes,
+ *         in_string is all ones when the block starts inside a string and is updated for the next block
+ */
+inline uint64_t get_string_chars(uint64_t quotes, uint64_t& in_string)
+{
+    uint64_t strings = quotes;
+    strings ^= (strings << 1u);
+    strings ^= (strings << 2u);
+    strings ^= (strings << 4u);
+    strings ^= (strings << 8u);
+    strings ^= (strings << 16u);
+    strings ^= (strings << 32u);
+    strings ^= in_string;
+    in_string = (static_cast<uint64_t>(0u) - (strings >> 63u));
+    return strings;
+}
+
+/** @brief Get the position of the next '"' or '\\' char in a part of a json string (end of the part if not found) :
+ *         short strings are the common case, so the chars are tested 16 at a time
+ *         without going through a block classification
+ */
+inline const char* find_string_char(const char* begin, const char* end)
+{
+    const char* position = begin;
+#if defined(__SSE2__)
+    const __m128i quote     = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    while ((end - position) >= static_cast<ptrdiff_t>(sizeof(__m128i)))
+    {
+        const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(position));
+        const int     mask  = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chars, quote), _mm_cmpeq_epi8(chars, backslash)));
+        if (mask != 0)
+        {
+            return (position + count_trailing_zeros(static_cast<uint64_t>(mask)));
+        }
+        position += sizeof(__m128i);
+    }
+#endif // defined(__SSE2__)
+    while ((position != end) && (*position != '"') && (*position != '\\'))
+    {
+        position++;
+    }
+    return position;
+}
+
+/** @brief Get the position of the next '"' or '\\' char in a part of a json string (end of the part if not found),
+ *         ascii is cleared if a non ASCII char is found before this position : the non ASCII chars are detected
+ *         from the same loads so that the strings which only contain ASCII chars don't need another pass
+ */
+inline const char* find_string_char(const char* begin, const char* end, bool& ascii)
+{
+    const char* position = begin;
+#if defined(__SSE2__)
+    const __m128i quote     = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    while ((end - position) >= static_cast<ptrdiff_t>(sizeof(__m128i)))
+    {
+        const __m128i chars     = _mm_loadu_si128(reinterpret_cast<const __m128i*>(position));
+        const int     mask      = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chars, quote), _mm_cmpeq_epi8(chars, backslash)));
+        const int     non_ascii = _mm_movemask_epi8(chars);
+        if (mask != 0)
+        {
+            // Only the non ASCII chars preceding the found char belong to the string
+            ascii = (ascii && ((non_ascii & (mask ^ (mask - 1))) == 0));
+            return (position + count_trailing_zeros(static_cast<uint64_t>(mask)));
+        }
+        ascii = (ascii && (non_ascii == 0));
+        position += sizeof(__m128i);
+    }
+#endif // defined(__SSE2__)
+    while ((position != end) && (*position != '"') && (*position != '\\'))
+    {
+        ascii = (ascii && (static_cast<uint8_t>(*position) < 0x80u));
+        position++;
+    }
+    return position;
+}
+
+} // namespace nanojsoncpp
+
+#endif // NANOJSONCPP_SCAN_H
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2025 c-jimenez
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef NANOJSONCPP_STREAM_PARSER_H
+#define NANOJSONCPP_STREAM_PARSER_H
+
+// This file is included at the end of nanojsoncpp.h and must not be included directly
+
+namespace nanojsoncpp
+{
+
+/** @brief Resumable json parser for json strings received in several chunks (UART frames, TCP segments...) :
+ *         the chunks are appended to a caller provided buffer and parsed as soon as they are received,
+ *         the search of an incomplete string at the end of a chunk resumes where it stopped when the next chunk is received
+ *         and the other incomplete tokens (numbers, literals) are parsed again.
+ *         This doesn't reduce the memory needed : the buffer must still hold the whole json string since the json values refer to it
+ */
+template <typename ErrorHandler>
+class json_stream_parser
+{
+  public:
+    /** @brief Constructor, the buffer must be big enough to store the whole json string */
+    json_stream_parser(const std::span<char>&            buffer,
+                       const std::span<json_value_desc>& descriptors,
+                       ErrorHandler                      error_handler = ErrorHandler())
+        : m_error_handler(error_handler),
+          m_value_handler(descriptors),
+          m_parser(m_error_handler, m_value_handler),
+          m_buffer(buffer),
+          m_descriptors(descriptors),
+          m_size(0u),
+          m_completed_count(0u),
+          m_completed_desc(nullptr)
+    {
+        m_parser.begin(m_buffer.data());
+    }
+
+    /** @brief Copy constructor (deleted : the parser refers to its own error handler) */
+    json_stream_parser(const json_stream_parser&) = delete;
+
+    /** @brief Copy operator (deleted : the parser refers to its own error handler) */
+    json_stream_parser& operator=(const json_stream_parser&) = delete;
+
+    /** @brief Append a chunk of the json string and parse it, returns false if an error has been detected */
+    bool feed(const std::string_view& chunk)
+    {
+        if (chunk.size() <= (m_buffer.size() - m_size))
+        {
+            std::memcpy(m_buffer.data() + m_size, chunk.data(), chunk.size());
+            m_size += chunk.size();
+            m_parser.resume(m_size, true);
+        }
+        else
+        {
+            // Error : The json string doesn't fit in the buffer
+            m_parser.abort(json_parse_error::json_too_big);
+        }
+        return m_parser.is_successful();
+    }
+
+    /** @brief Indicate that the whole json string has been received, returns the root value if the json string is valid */
+    std::optional<json_value> finish()
+    {
+        m_parser.resume(m_size, false);
+        return m_parser.end(get_json_string());
+    }
+
+    /** @brief Restart the parsing of a new json string */
+    void reset()
+    {
+        m_size            = 0u;
+        m_completed_count = 0u;
+        m_completed_desc  = nullptr;
+        m_parser.begin(m_buffer.data());
+    }
+
+    /** @brief Indicate if the root object/array has been completely received */
+    bool is_complete() const { return m_parser.is_complete(); }
+
+    /** @brief Get the part of the json string received so far */
+    std::string_view get_json_string() const { return std::string_view(m_buffer.data(), m_size); }
+
+    /** @brief Get the next member/element of the root object/array which has been completely parsed since the previous call,
+     *         allows to process the values before the end of the json string has been received
+     */
+    std::optional<json_value> next_completed()
+    {
+        std::optional<json_value> value;
+
+        if (m_parser.is_successful() && (m_completed_count < m_parser.get_completed_count()))
+        {
+            // The descriptors of the following value are only known to be valid once it has been completely parsed
+            if (m_completed_desc == nullptr)
+            {
+                m_completed_desc = &m_descriptors[1u];
+            }
+            else
+            {
+                m_completed_desc = json_value::get_next_sibling(m_completed_desc);
+            }
+            m_completed_count++;
+            value = json_value(get_json_string(), *m_completed_desc);
+        }
+
+        return value;
+    }
+
+  private:
+    /** @brief Error handler */
+    ErrorHandler m_error_handler;
+    /** @brief Value handler storing the values in the descriptors */
+    desc_value_handler m_value_handler;
+    /** @brief Parser */
+    json_parser<ErrorHandler, desc_value_handler> m_parser;
+    /** @brief Buffer storing the received chunks */
+    std::span<char> m_buffer;
+    /** @brief Descriptors */
+    std::span<json_value_desc> m_descriptors;
+    /** @brief Number of chars received */
+    size_t m_size;
+    /** @brief Number of completed values returned by next_completed() */
+    json_size_t m_completed_count;
+    /** @brief Descriptor of the last completed value returned by next_completed() */
+    json_value_desc* m_completed_desc;
+};
+
+} // namespace nanojsoncpp
+
+#endif // NANOJSONCPP_STREAM_PARSER_H
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2025 c-jimenez
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef NANOJSONCPP_UTF8_H
+#define NANOJSONCPP_UTF8_H
+
+// Standard headers
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// nanojsoncpp headers
+#include <nanojsoncpp/private/scan.h>
+
+namespace nanojsoncpp
+{
+
+/** @brief Get the position of the next non ASCII char in a part of a json string (end of the part if not found) :
+ *         the chars are tested 16 at a time on x86 and a machine word at a time on the other CPUs
+ */
+inline const char* skip_ascii_chars(const char* begin, const char* end)
+{
+    const char* position = begin;
+#if defined(__SSE2__)
+    while ((end - position) >= static_cast<ptrdiff_t>(sizeof(__m128i)))
+    {
+        const int mask = _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(position)));
+        if (mask != 0)
+        {
+            return (position + count_trailing_zeros(static_cast<uint64_t>(mask)));
+        }
+        position += sizeof(__m128i);
+    }
+#endif // defined(__SSE2__)
+    constexpr uintptr_t HIGH_BITS = static_cast<uintptr_t>(0x8080808080808080ull);
+    while ((end - position) >= static_cast<ptrdiff_t>(sizeof(uintptr_t)))
+    {
+        uintptr_t word;
+        memcpy(&word, position, sizeof(word));
+        if ((word & HIGH_BITS) != 0u)
+        {
+            break;
+        }
+        position += sizeof(uintptr_t);
+    }
+    while ((position != end) && (static_cast<uint8_t>(*position) < 0x80u))
+    {
+        position++;
+    }
+    return position;
+}
+
+/** @brief Get the size of the UTF-8 sequence starting with a non ASCII char, 0 if the sequence is invalid
+ *         (overlong encoding, surrogate, code point above U+10FFFF or truncated sequence)
+ */
+inline size_t get_utf8_sequence_size(const char* begin, const char* end)
+{
+    const uint8_t lead = static_cast<uint8_t>(*begin);
+    size_t        size = 0u;
+    uint8_t       min  = 0x80u;
+    uint8_t       max  = 0xBFu;
+    if ((lead >= 0xC2u) && (lead <= 0xDFu))
+    {
+        size = 2u;
+    }
+    else if ((lead >= 0xE0u) && (lead <= 0xEFu))
+    {
+        size = 3u;
+        if (lead == 0xE0u)
+        {
+            min = 0xA0u;
+        }
+        if (lead == 0xEDu)
+        {
+            max = 0x9Fu;
+        }
+    }
+    else if ((lead >= 0xF0u) && (lead <= 0xF4u))
+    {
+        size = 4u;
+        if (lead == 0xF0u)
+        {
+            min = 0x90u;
+        }
+        if (lead == 0xF4u)
+        {
+            max = 0x8Fu;
+        }
+    }
+    if ((size != 0u) && (static_cast<size_t>(end - begin) >= size))
+    {
+        // The second byte has a restricted range, the following ones are plain continuation bytes
+        const uint8_t second = static_cast<uint8_t>(begin[1u]);
+        bool          valid  = ((second >= min) && (second <= max));
+        for (size_t i = 2u; i < size; i++)
+        {
+            valid = (valid && ((static_cast<uint8_t>(begin[i]) & 0xC0u) == 0x80u));
+        }
+        size = (valid ? size : 0u);
+    }
+    else
+    {
+        size = 0u;
+    }
+    return size;
+}
+
+/** @brief Get the position of the first invalid UTF-8 sequence in a part of a json string (end of the part if the part is valid),
+ *         ascii is set if the checked chars are all ASCII chars
+ */
+inline const char* find_invalid_utf8(const char* begin, const char* end, bool& ascii)
+{
+    const char* position = skip_ascii_chars(begin, end);
+    ascii                = (position == end);
+    while (position != end)
+    {
+        const size_t size = get_utf8_sequence_size(position, end);
+        if (size == 0u)
+        {
+            break;
+        }
+        position = skip_ascii_chars(position + size, end);
+    }
+    return position;
+}
+
+} // namespace nanojsoncpp
+
+#endif // NANOJSONCPP_UTF8_H
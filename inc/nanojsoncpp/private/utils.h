@@ -29,6 +29,46 @@ json_int_t to_int(const std::string_view& str);
 /** @brief Convert a floting point value represented as a string to a floating point value */
 json_float_t to_float(const std::string_view& str);
 
+/** @brief Indicate if a json string value only contains ASCII chars, including the chars given by its \\uXXXX escaped chars */
+bool is_ascii(const std::string_view& str);
+
+/** @brief Get the value of an hexadecimal digit, 0xFF if the char is not an hexadecimal digit */
+constexpr uint8_t get_hex_digit(char c)
+{
+    uint8_t value = 0xFFu;
+    if ((c >= '0') && (c <= '9'))
+    {
+        value = static_cast<uint8_t>(c - '0');
+    }
+    else if ((c >= 'a') && (c <= 'f'))
+    {
+        value = static_cast<uint8_t>(c - 'a' + 10);
+    }
+    else if ((c >= 'A') && (c <= 'F'))
+    {
+        value = static_cast<uint8_t>(c - 'A' + 10);
+    }
+    return value;
+}
+
+/** @brief Convert the escaped chars of a json string value, the \\uXXXX escaped chars being converted to UTF-8 :
+ *         the buffer must be at least as big as the string and can be the string itself,
+ *         returns the size of the converted string
+ */
+size_t unescape(const std::string_view& str, char* buffer);
+
+/** @brief Compute the hash of a value name (32 bits FNV-1a) */
+constexpr uint32_t hash_name(const std::string_view& name)
+{
+    uint32_t hash = 2166136261u;
+    for (char c : name)
+    {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
 /** @brief Convert an integer value to a string */
 size_t to_string(json_int_t val, const std::span<char>& buff);
 
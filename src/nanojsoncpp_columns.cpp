@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2025 c-jimenez
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <nanojsoncpp/nanojsoncpp.h>
+
+namespace nanojsoncpp
+{
+
+/**/
+/* ------------ json_value methods ------------ */
+/**/
+
+/** @brief Extract the members of the objects of an array into columns (1 per member name) in a single pass over their descriptors */
+json_array_result json_value::get_columns(const std::span<json_column>& columns) const
+{
+    json_array_result result = {0u, json_array_error::no_error};
+
+    if (type() != json_value_type::array)
+    {
+        result.error = json_array_error::not_an_array;
+    }
+    else
+    {
+        // Check the storages and forget the positions of the previous extraction
+        for (auto& column : columns)
+        {
+            if (column.m_size < size())
+            {
+                result.error = json_array_error::not_enough_memory;
+            }
+            column.m_offset = 0u;
+        }
+
+        json_value_desc* object = (m_desc + 1u);
+        while ((result.count < size()) && (result.error == json_array_error::no_error))
+        {
+            json_value_desc* end = get_next_sibling(object);
+            if (object->type == json_value_type::object)
+            {
+                for (size_t i = 0u; (i < columns.size()) && (result.error == json_array_error::no_error); i++)
+                {
+                    json_column&     column = columns[i];
+                    json_value_desc* member = find_column_member(object, end, column);
+                    if (member == nullptr)
+                    {
+                        result.error = json_array_error::missing_member;
+                    }
+                    else if (!column.m_store(column.m_values, result.count, get_nested(*member)))
+                    {
+                        result.error = json_array_error::mixed_types;
+                    }
+                    else
+                    {
+                        // Member stored
+                    }
+                }
+            }
+            else
+            {
+                result.error = json_array_error::not_an_object;
+            }
+            if (result.error == json_array_error::no_error)
+            {
+                result.count++;
+                object = end;
+            }
+        }
+    }
+
+    return result;
+}
+
+/** @brief Get the descriptor of the member of an object corresponding to a column (nullptr if not found), end is the descriptor
+ *         following the object : the position of the member in the previous object is tried before looking up the member
+ */
+json_value_desc* json_value::find_column_member(json_value_desc* object, json_value_desc* end, json_column& column) const
+{
+    // The position is only valid if it is a member of this object (and not a value nested in one of its members)
+    json_value_desc* member = nullptr;
+    if ((column.m_offset != 0u) && (static_cast<ptrdiff_t>(column.m_offset) < (end - object)))
+    {
+        json_value_desc* desc = (object + column.m_offset);
+        if ((desc->nesting_level == static_cast<uint8_t>(object->nesting_level + 1u)) && has_key(*desc, column.m_key))
+        {
+            member = desc;
+        }
+    }
+    if (member == nullptr)
+    {
+        // Look up the member
+        json_value_desc* desc = (object + 1u);
+        for (json_size_t i = 0u; (i < object->value_size) && (member == nullptr); i++)
+        {
+            if (has_key(*desc, column.m_key))
+            {
+                member = desc;
+            }
+            else
+            {
+                desc = get_next_sibling(desc);
+            }
+        }
+        column.m_offset = ((member != nullptr) ? static_cast<json_size_t>(member - object) : 0u);
+    }
+    return member;
+}
+
+/** @brief Indicate if a descriptor has the name of a key */
+bool json_value::has_key(const json_value_desc& desc, const json_key& key) const
+{
+#ifdef NANOJSONCPP_USE_NAME_HASH
+    // Compare hashes and sizes before comparing the names
+    return ((desc.name_hash == static_cast<json_size_t>(key.hash())) && is_named(desc, key.name()));
+#else
+    return (m_json_string.substr(desc.name_start, desc.name_size) == key.name());
+#endif // NANOJSONCPP_USE_NAME_HASH
+}
+
+} // namespace nanojsoncpp
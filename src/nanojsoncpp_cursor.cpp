@@ -0,0 +1,477 @@
+/*
+ * Copyright (c) 2025 c-jimenez
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <nanojsoncpp/nanojsoncpp.h>
+
+namespace nanojsoncpp
+{
+
+/**/
+/* ------------ Internal functions declaration ------------ */
+/**/
+
+/** @brief Get the position of the next char which is not a blank char (end of string if not found) */
+static const char* skip_blank_chars(const char* position, const char* end);
+
+/** @brief Get the position of the next '"' or '\\' char (end of string if not found) */
+static const char* next_string_char(const char* position, const char* end);
+
+/** @brief Get the position of the '"' char ending a string starting after its opening '"' char (end of string if not found) */
+static const char* find_string_end(const char* position, const char* end);
+
+/** @brief Get the position following an object/array starting at the given position (nullptr if the object/array is not terminated) */
+static const char* skip_nested_value(const char* position, const char* end);
+
+/** @brief Get the position following a value starting at the given position (nullptr if the value is invalid) */
+static const char* skip_value(const char* position, const char* end);
+
+/**/
+/* ------------ API functions ------------ */
+/**/
+
+/** @brief Get an on-demand access to the values of a json string without parsing it : only the root object/array is checked */
+std::optional<json_cursor> parse_on_demand(const std::string_view& json_string)
+{
+    std::optional<json_cursor> root;
+
+    // json string is either an object or an array
+    const char* end        = json_string.data() + json_string.size();
+    const char* root_start = skip_blank_chars(json_string.data(), end);
+    if (root_start != end)
+    {
+        const char_class c_class = get_char_class(*root_start);
+        if ((c_class == char_class::begin_object) || (c_class == char_class::begin_array))
+        {
+            root = json_cursor(std::string_view(root_start, static_cast<size_t>(end - root_start)), std::string_view());
+        }
+    }
+
+    return root;
+}
+
+/** @brief Get the type of the value */
+json_value_type json_cursor::type() const
+{
+    json_value_type value_type = json_value_type::null;
+
+    switch (get_char_class(m_value[0u]))
+    {
+        case char_class::quote:
+            value_type = json_value_type::string;
+            break;
+
+        case char_class::begin_object:
+            value_type = json_value_type::object;
+            break;
+
+        case char_class::begin_array:
+            value_type = json_value_type::array;
+            break;
+
+        case char_class::true_literal:
+        case char_class::false_literal:
+            value_type = json_value_type::boolean;
+            break;
+
+        case char_class::digit:
+        case char_class::minus:
+        {
+            // Integer unless a decimal point or an exponent is present
+            if (get().find_first_of(".eE") == std::string_view::npos)
+            {
+                value_type = json_value_type::integer;
+            }
+            else
+            {
+                value_type = json_value_type::decimal;
+            }
+        }
+        break;
+
+        default:
+            // Null value
+            break;
+    }
+
+    return value_type;
+}
+
+/** @brief Get the size of the value */
+json_size_t json_cursor::size() const
+{
+    json_size_t value_size = 0u;
+
+    const json_value_type value_type = type();
+    if ((value_type == json_value_type::object) || (value_type == json_value_type::array))
+    {
+        for (auto it = begin(); it != end(); ++it)
+        {
+            value_size++;
+        }
+    }
+    else
+    {
+        value_size = static_cast<json_size_t>(get().size());
+    }
+
+    return value_size;
+}
+
+/** @brief Get the value as a string view (string values without quotes, whole string representation for the other types) */
+std::string_view json_cursor::get() const
+{
+    std::string_view value;
+
+    const char* value_start = m_value.data();
+    const char* value_end   = skip_value(value_start, value_start + m_value.size());
+    if (value_end != nullptr)
+    {
+        if (*value_start == '"')
+        {
+            value = std::string_view(value_start + 1u, static_cast<size_t>(value_end - value_start) - 2u);
+        }
+        else
+        {
+            value = std::string_view(value_start, static_cast<size_t>(value_end - value_start));
+        }
+    }
+
+    return value;
+}
+
+/** @brief Get a member value (only for object types) */
+std::optional<json_cursor> json_cursor::get(const std::string_view& name) const
+{
+    std::optional<json_cursor> value;
+
+    if (type() == json_value_type::object)
+    {
+        for (const auto& member : (*this))
+        {
+            if (member.name() == name)
+            {
+                value = member;
+                break;
+            }
+        }
+    }
+
+    return value;
+}
+
+/** @brief Get an array value (only for array types) */
+std::optional<json_cursor> json_cursor::get(json_size_t index) const
+{
+    std::optional<json_cursor> value;
+
+    if (type() == json_value_type::array)
+    {
+        json_size_t val_index = 0u;
+        for (const auto& element : (*this))
+        {
+            if (val_index == index)
+            {
+                value = element;
+                break;
+            }
+            else
+            {
+                val_index++;
+            }
+        }
+    }
+
+    return value;
+}
+
+/** @brief Get the first member/element of an object/array */
+std::optional<json_cursor> json_cursor::get_first_child() const
+{
+    std::optional<json_cursor> child;
+
+    const json_value_type value_type = type();
+    if ((value_type == json_value_type::object) || (value_type == json_value_type::array))
+    {
+        // Check if the object/array is empty
+        const char* end      = m_value.data() + m_value.size();
+        const char* position = skip_blank_chars(m_value.data() + 1u, end);
+        if ((position != end) && (*position != '}') && (*position != ']'))
+        {
+            child = get_child(position, end, (value_type == json_value_type::object));
+        }
+    }
+
+    return child;
+}
+
+/** @brief Get the member/element following this one in its object/array */
+std::optional<json_cursor> json_cursor::get_next_sibling(bool is_member) const
+{
+    std::optional<json_cursor> sibling;
+
+    // Skip the value and look for a member separator
+    const char* end      = m_value.data() + m_value.size();
+    const char* position = skip_value(m_value.data(), end);
+    if (position != nullptr)
+    {
+        position = skip_blank_chars(position, end);
+        if ((position != end) && (*position == ','))
+        {
+            sibling = get_child(skip_blank_chars(position + 1u, end), end, is_member);
+        }
+    }
+
+    return sibling;
+}
+
+/** @brief Locate a member/element starting at the given position */
+std::optional<json_cursor> json_cursor::get_child(const char* position, const char* end, bool is_member)
+{
+    std::optional<json_cursor> child;
+
+    // Extract member name
+    bool             valid = true;
+    std::string_view name;
+    if (is_member)
+    {
+        valid = false;
+        if ((position != end) && (*position == '"'))
+        {
+            const char* name_end = find_string_end(position + 1u, end);
+            if (name_end != end)
+            {
+                name     = std::string_view(position + 1u, static_cast<size_t>(name_end - position) - 1u);
+                position = skip_blank_chars(name_end + 1u, end);
+                if ((position != end) && (*position == ':'))
+                {
+                    position = skip_blank_chars(position + 1u, end);
+                    valid    = true;
+                }
+            }
+        }
+    }
+
+    // Check the start of the value
+    if (valid && (position != end))
+    {
+        switch (get_char_class(*position))
+        {
+            case char_class::quote:
+            case char_class::begin_object:
+            case char_class::begin_array:
+            case char_class::digit:
+            case char_class::minus:
+            case char_class::null_literal:
+            case char_class::true_literal:
+            case char_class::false_literal:
+                child = json_cursor(std::string_view(position, static_cast<size_t>(end - position)), name);
+                break;
+
+            default:
+                // Error : invalid value
+                break;
+        }
+    }
+
+    return child;
+}
+
+/**/
+/* ------------ Internal functions ------------ */
+/**/
+
+/** @brief Get the position of the next char which is not a blank char (end of string if not found) */
+static const char* skip_blank_chars(const char* position, const char* end)
+{
+    while ((position != end) && (get_char_class(*position) == char_class::blank))
+    {
+        position++;
+    }
+    return position;
+}
+
+/** @brief Get the position of the next '"' or '\\' char (end of string if not found) */
+static const char* next_string_char(const char* position, const char* end)
+{
+#ifdef NANOJSONCPP_USE_SIMD_SCAN
+    return find_string_char(position, end);
+#else
+    while ((position != end) && (*position != '"') && (*position != '\\'))
+    {
+        position++;
+    }
+    return position;
+#endif // NANOJSONCPP_USE_SIMD_SCAN
+}
+
+/** @brief Get the position of the '"' char ending a string starting after its opening '"' char (end of string if not found) */
+static const char* find_string_end(const char* position, const char* end)
+{
+    position = next_string_char(position, end);
+    while ((position != end) && (*position == '\\'))
+    {
+        // Skip escaped char
+        if ((end - position) > 2)
+        {
+            position = next_string_char(position + 2u, end);
+        }
+        else
+        {
+            position = end;
+        }
+    }
+    return position;
+}
+
+/** @brief Get the position following an object/array starting at the given position (nullptr if the object/array is not terminated) */
+static const char* skip_nested_value(const char* position, const char* end)
+{
+    const char* value_end     = nullptr;
+    size_t      nesting_level = 0u;
+
+#ifdef NANOJSONCPP_USE_SIMD_SCAN
+    // The brackets are counted on blocks of chars classified at once : the chars inside the strings
+    // are found by computing the parity of the unescaped quotes preceding each char of the block
+    uint64_t    in_string = 0u;
+    bool        escaped   = false;
+    const char* block     = position;
+    while ((value_end == nullptr) && (block < end))
+    {
+        scan_block_masks masks;
+        const size_t     left = static_cast<size_t>(end - block);
+        if (left >= SCAN_BLOCK_SIZE)
+        {
+            masks = scan_block(block);
+        }
+        else
+        {
+            // Last block, pad with blank chars
+            char padded_block[SCAN_BLOCK_SIZE];
+            for (size_t i = 0u; i < SCAN_BLOCK_SIZE; i++)
+            {
+                padded_block[i] = ((i < left) ? block[i] : ' ');
+            }
+            masks = scan_block(padded_block);
+        }
+
+        // Count the brackets outside the strings
+        const uint64_t strings = get_string_chars(get_unescaped_quotes(masks, escaped), in_string);
+        uint64_t structurals = (masks.structurals & ~strings);
+        while ((value_end == nullptr) && (structurals != 0u))
+        {
+            const unsigned int structural = count_trailing_zeros(structurals);
+            const char         c          = block[structural];
+            if ((c == '{') || (c == '['))
+            {
+                nesting_level++;
+            }
+            else if ((c == '}') || (c == ']'))
+            {
+                nesting_level--;
+                if (nesting_level == 0u)
+                {
+                    value_end = block + structural + 1u;
+                }
+            }
+            structurals &= (structurals - 1u);
+        }
+        block += SCAN_BLOCK_SIZE;
+    }
+#else
+    // Balance the brackets, the strings may contain brackets
+    const char* next = position;
+    while ((value_end == nullptr) && (next != end))
+    {
+        switch (*next)
+        {
+            case '"':
+            {
+                next = find_string_end(next + 1u, end);
+                if (next != end)
+                {
+                    next++;
+                }
+            }
+            break;
+
+            case '{':
+            case '[':
+            {
+                nesting_level++;
+                next++;
+            }
+            break;
+
+            case '}':
+            case ']':
+            {
+                nesting_level--;
+                next++;
+                if (nesting_level == 0u)
+                {
+                    value_end = next;
+                }
+            }
+            break;
+
+            default:
+                next++;
+                break;
+        }
+    }
+#endif // NANOJSONCPP_USE_SIMD_SCAN
+
+    return value_end;
+}
+
+/** @brief Get the position following a value starting at the given position (nullptr if the value is invalid) */
+static const char* skip_value(const char* position, const char* end)
+{
+    const char* value_end = nullptr;
+
+    switch (get_char_class(*position))
+    {
+        case char_class::quote:
+        {
+            // String value
+            const char* string_end = find_string_end(position + 1u, end);
+            if (string_end != end)
+            {
+                value_end = string_end + 1u;
+            }
+        }
+        break;
+
+        case char_class::begin_object:
+        case char_class::begin_array:
+            value_end = skip_nested_value(position, end);
+            break;
+
+        default:
+        {
+            // Litteral or decimal value : ends at the next blank or structural char
+            const char* next = position;
+            while (next != end)
+            {
+                const char_class c_class = get_char_class(*next);
+                if ((c_class == char_class::blank) || (c_class == char_class::value_separator) || (c_class == char_class::end_object) ||
+                    (c_class == char_class::end_array))
+                {
+                    break;
+                }
+                next++;
+            }
+            if (next != position)
+            {
+                value_end = next;
+            }
+        }
+        break;
+    }
+
+    return value_end;
+}
+
+} // namespace nanojsoncpp
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2025 c-jimenez
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <nanojsoncpp/nanojsoncpp.h>
+#include <nanojsoncpp/private/scan.h>
+
+namespace nanojsoncpp
+{
+
+/**/
+/* ------------ Internal functions declaration ------------ */
+/**/
+
+/** @brief Check if a path component is the decimal representation of an array index */
+static bool is_path_index(const std::string_view& component, json_size_t index);
+
+/**/
+/* ------------ json_path_filter methods ------------ */
+/**/
+
+/** @brief Constructor, the paths are not copied and must remain valid as long as the filter is used */
+json_path_filter::json_path_filter(const std::span<const std::string_view>& paths)
+    : m_paths(paths), m_valid(paths.size() <= MAX_FILTER_PATHS), m_ending(), m_wildcards(), m_separators()
+{
+    for (size_t i = 0u; m_valid && (i < paths.size()); i++)
+    {
+        // Locate the components
+        const std::string_view& path  = paths[i];
+        const uint64_t          bit   = (static_cast<uint64_t>(1u) << i);
+        uint8_t                 depth = 0u;
+        size_t                  pos   = 0u;
+        m_valid                       = (!path.empty() && (path[0u] == '/') && (path.size() <= MAX_FILTER_PATH_SIZE));
+        while (m_valid && (pos != path.size()))
+        {
+            size_t component_end = path.find('/', pos + 1u);
+            if (component_end == std::string_view::npos)
+            {
+                component_end = path.size();
+            }
+            m_valid = ((component_end != (pos + 1u)) && (depth != MAX_FILTER_PATH_DEPTH));
+            if (m_valid)
+            {
+                m_separators[i][depth] = static_cast<uint8_t>(pos);
+                depth++;
+                if (path.substr(pos + 1u, component_end - pos - 1u) == "*")
+                {
+                    m_wildcards[depth] |= bit;
+                }
+            }
+            pos = component_end;
+        }
+        if (m_valid)
+        {
+            m_separators[i][depth] = static_cast<uint8_t>(path.size());
+            m_ending[depth] |= bit;
+        }
+    }
+}
+
+/** @brief Among the given paths, get the ones whose component at the given depth (1 = first component)
+ *         matches an object's member name or an array's element index
+ */
+uint64_t json_path_filter::match(uint64_t paths, uint8_t depth, bool is_member, const std::string_view& name, json_size_t index) const
+{
+    uint64_t matching = 0u;
+
+    if (depth <= MAX_FILTER_PATH_DEPTH)
+    {
+        // Wildcards match any member/element
+        matching = (paths & m_wildcards[depth]);
+        paths &= ~matching;
+
+        // Compare the other components
+        while (paths != 0u)
+        {
+            const unsigned int path = count_trailing_zeros(paths);
+            if (m_separators[path][depth] > m_separators[path][depth - 1u])
+            {
+                const size_t           component_start = m_separators[path][depth - 1u] + 1u;
+                const std::string_view component = m_paths[path].substr(component_start, m_separators[path][depth] - component_start);
+                if ((is_member && (component == name)) || (!is_member && is_path_index(component, index)))
+                {
+                    matching |= (static_cast<uint64_t>(1u) << path);
+                }
+            }
+            paths &= (paths - 1u);
+        }
+    }
+
+    return matching;
+}
+
+/**/
+/* ------------ Internal functions ------------ */
+/**/
+
+/** @brief Check if a path component is the decimal representation of an array index : as in JSON pointers, an index
+ *         has no leading zero and must fit in a json_size_t
+ */
+static bool is_path_index(const std::string_view& component, json_size_t index)
+{
+    constexpr json_size_t MAX_INDEX = std::numeric_limits<json_size_t>::max();
+
+    bool is_index = ((component.size() != 0u) && (component.size() <= (std::numeric_limits<json_size_t>::digits10 + 1u)) &&
+                     ((component.size() == 1u) || (component[0u] != '0')));
+    json_size_t value = 0u;
+    for (size_t i = 0u; is_index && (i < component.size()); i++)
+    {
+        const char c = component[i];
+        is_index     = ((c >= '0') && (c <= '9'));
+        if (is_index)
+        {
+            // Check the overflow before accumulating the digit
+            const json_size_t digit = static_cast<json_size_t>(c - '0');
+            is_index                = (value <= ((MAX_INDEX - digit) / 10u));
+            value                   = static_cast<json_size_t>((value * 10u) + digit);
+        }
+    }
+    return (is_index && (value == index));
+}
+
+} // namespace nanojsoncpp
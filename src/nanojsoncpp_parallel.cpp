@@ -0,0 +1,490 @@
+/*
+ * Copyright (c) 2025 c-jimenez
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <nanojsoncpp/nanojsoncpp_parallel.h>
+#include <nanojsoncpp/private/scan.h>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace nanojsoncpp
+{
+
+/**/
+/* ------------ Internal types ------------ */
+/**/
+
+/** @brief Chunks waiting to be parsed by a thread, the other threads can steal them */
+struct chunk_queue
+{
+    /** @brief Mutex protecting the range of chunks */
+    std::mutex mutex;
+    /** @brief Index of the first remaining chunk */
+    size_t first;
+    /** @brief Index following the last remaining chunk */
+    size_t last;
+};
+
+/** @brief Context shared by the threads of a parallel parsing */
+struct parallel_context
+{
+    /** @brief Json string */
+    std::string_view json_string;
+    /** @brief Start of the chunks in the json string (+ end of the last chunk) */
+    std::vector<size_t> chunks;
+    /** @brief Chunks of each thread */
+    std::vector<chunk_queue> queues;
+    /** @brief Descriptors of the threads */
+    std::span<json_value_desc> descriptors;
+    /** @brief Document handler */
+    const parallel_document_handler_t& document_handler;
+    /** @brief Error handler */
+    const parallel_error_handler_t& error_handler;
+    /** @brief Mutex serializing the calls to the error handler */
+    std::mutex error_mutex;
+    /** @brief Indicate if an invalid document has been found */
+    std::atomic<bool> failed;
+};
+
+/** @brief Brackets and root separators found in a chunk of a json string for both possible string states at the start of the chunk
+ *         (index 0 = outside a string, index 1 = inside a string)
+ */
+struct chunk_scan
+{
+    /** @brief Marker of a missing separator */
+    static constexpr size_t NO_SEPARATOR = static_cast<size_t>(-1);
+
+    /** @brief Indicate if the chunk contains an odd number of unescaped quotes */
+    bool odd_quotes;
+    /** @brief Variation of the nesting level over the chunk */
+    int depth_delta[2u];
+    /** @brief Position of the first ',' of the chunk for each nesting level at the start of the chunk in [1;MAX_NESTING_LEVEL] :
+     *         the ',' is a separator of the root object/array when its nesting level relatively to the start of the chunk
+     *         is (1 - nesting level at the start of the chunk)
+     */
+    size_t separators[2u][MAX_NESTING_LEVEL];
+};
+
+/** @brief Result of the parsing of a part of a json string */
+struct part_result
+{
+    /** @brief Indicate if the part has been parsed up to its end without error */
+    bool success;
+    /** @brief Number of descriptors used by the part (without the end marker) */
+    json_size_t values_count;
+    /** @brief Number of members/elements of the root object/array found in the part */
+    json_size_t root_size;
+};
+
+/**/
+/* ------------ Internal functions declaration ------------ */
+/**/
+
+/** @brief Get the positions following the root separators where a json string can be split in parts of nearly the same size */
+static std::vector<size_t> find_parts(const std::string_view& json_string, size_t parts_count);
+
+/** @brief Find the brackets and the separators of a chunk of a json string */
+static void scan_chunk(const std::string_view& json_string, size_t chunk_start, size_t chunk_end, chunk_scan& scan);
+
+/** @brief Parse a part of a json string into its own part of the descriptors */
+static void parse_part(const std::string_view&           json_string,
+                       const std::span<json_value_desc>& descriptors,
+                       size_t                            part_start,
+                       size_t                            part_end,
+                       json_value_type                   root_type,
+                       part_result&                      result);
+
+/** @brief Parse the chunks of a thread, then the chunks stolen from the other threads */
+static void parse_chunks(parallel_context& context, size_t thread_index);
+
+/** @brief Parse the documents of a chunk, returns false if an invalid document has been found */
+static bool parse_chunk(parallel_context& context, size_t thread_index, size_t chunk);
+
+/** @brief Get the next chunk of a thread */
+static bool pop_chunk(chunk_queue& queue, size_t& chunk);
+
+/** @brief Steal the last chunk of another thread */
+static bool steal_chunk(chunk_queue& queue, size_t& chunk);
+
+/**/
+/* ------------ API functions ------------ */
+/**/
+
+/** @brief Parse the documents of a newline delimited json string (NDJSON) using several threads */
+bool parse_many_parallel(const std::string_view&            json_string,
+                         const std::span<json_value_desc>&  descriptors,
+                         size_t                             threads_count,
+                         const parallel_document_handler_t& document_handler,
+                         const parallel_error_handler_t&    error_handler)
+{
+    if (threads_count == 0u)
+    {
+        threads_count = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    // Split the json string in chunks starting after a newline char
+    parallel_context context{json_string, {}, std::vector<chunk_queue>(threads_count), descriptors, document_handler, error_handler, {}, {false}};
+    const size_t     chunks_count = threads_count * PARALLEL_CHUNKS_PER_THREAD;
+    context.chunks.reserve(chunks_count + 1u);
+    context.chunks.push_back(0u);
+    for (size_t i = 1u; i < chunks_count; i++)
+    {
+        const size_t newline = json_string.find('\n', std::max((json_string.size() / chunks_count) * i, context.chunks.back()));
+        context.chunks.push_back((newline == std::string_view::npos) ? json_string.size() : (newline + 1u));
+    }
+    context.chunks.push_back(json_string.size());
+
+    // Give the same number of chunks to each thread
+    for (size_t i = 0u; i < threads_count; i++)
+    {
+        context.queues[i].first = i * PARALLEL_CHUNKS_PER_THREAD;
+        context.queues[i].last  = context.queues[i].first + PARALLEL_CHUNKS_PER_THREAD;
+    }
+
+    // The calling thread is used as the first thread
+    std::vector<std::thread> threads;
+    threads.reserve(threads_count - 1u);
+    for (size_t i = 1u; i < threads_count; i++)
+    {
+        threads.emplace_back(parse_chunks, std::ref(context), i);
+    }
+    parse_chunks(context, 0u);
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    return !context.failed;
+}
+
+/** @brief Parse a big json string using several threads */
+std::optional<json_value> parse_parallel(const std::string_view&           json_string,
+                                         const std::span<json_value_desc>& descriptors,
+                                         size_t                            threads_count,
+                                         parse_error_handler_t             error_handler)
+{
+    std::optional<json_value> root;
+
+    if (threads_count == 0u)
+    {
+        threads_count = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    threads_count = std::min(threads_count, json_string.size() / PARALLEL_MIN_PART_SIZE);
+    if (threads_count > 1u)
+    {
+        // Split the json string between the members/elements of the root object/array
+        const std::vector<size_t> parts = find_parts(json_string, threads_count);
+        if (parts.size() > 2u)
+        {
+            // The type of the root object/array is needed to start the parsing in the middle of it
+            const size_t          root_start = json_string.find_first_not_of(" \t\r\n");
+            const json_value_type root_type  = (((root_start != std::string_view::npos) && (json_string[root_start] == '{'))
+                                                    ? json_value_type::object
+                                                    : json_value_type::array);
+
+            // Parse each part into its own part of the descriptors
+            const size_t             parts_count       = parts.size() - 1u;
+            const size_t             descriptors_count = descriptors.size() / parts_count;
+            std::vector<part_result> results(parts_count);
+            std::vector<std::thread> threads;
+            threads.reserve(parts_count - 1u);
+            for (size_t i = 1u; i < parts_count; i++)
+            {
+                threads.emplace_back(parse_part,
+                                     json_string,
+                                     descriptors.subspan(i * descriptors_count, descriptors_count),
+                                     parts[i],
+                                     parts[i + 1u],
+                                     root_type,
+                                     std::ref(results[i]));
+            }
+            parse_part(json_string, descriptors.subspan(0u, descriptors_count), parts[0u], parts[1u], root_type, results[0u]);
+            bool success = results[0u].success;
+            for (size_t i = 0u; i < threads.size(); i++)
+            {
+                threads[i].join();
+                success = (success && results[i + 1u].success);
+            }
+
+            if (success)
+            {
+                // Gather the values of the parts after the values of the first part, the root descriptor of the other parts is skipped
+                json_value_desc& root_desc = descriptors[0u];
+                size_t           count     = results[0u].values_count;
+                for (size_t i = 1u; i < parts_count; i++)
+                {
+                    const size_t part_count = results[i].values_count - 1u;
+                    std::memmove(&descriptors[count], &descriptors[(i * descriptors_count) + 1u], part_count * sizeof(json_value_desc));
+                    root_desc.value_size = static_cast<json_size_t>(root_desc.value_size + results[i].root_size - 1u);
+                    count += part_count;
+                }
+#ifdef NANOJSONCPP_USE_SUBTREE_SIZE
+                root_desc.subtree_size = static_cast<json_size_t>(count - 1u);
+#endif // NANOJSONCPP_USE_SUBTREE_SIZE
+
+                // End marker
+                json_value_desc& end_marker = descriptors[count];
+                end_marker.nesting_level    = 0u;
+                end_marker.name_start       = 0u;
+                end_marker.name_size        = 0u;
+                end_marker.value_start      = 0u;
+                end_marker.value_size       = 0u;
+#ifdef NANOJSONCPP_USE_SUBTREE_SIZE
+                end_marker.subtree_size = 0u;
+#endif // NANOJSONCPP_USE_SUBTREE_SIZE
+
+                root = json_value(json_string, root_desc);
+            }
+        }
+    }
+
+    if (!root)
+    {
+        // Small or invalid json string, or not enough descriptors for a part
+        root = parse(json_string, descriptors, error_handler);
+    }
+
+    return root;
+}
+
+/**/
+/* ------------ Internal functions ------------ */
+/**/
+
+/** @brief Get the positions following the root separators where a json string can be split in parts of nearly the same size,
+ *         the first position is the start of the json string and the last position is its end
+ */
+static std::vector<size_t> find_parts(const std::string_view& json_string, size_t parts_count)
+{
+    // Scan chunks of the same size in parallel, each chunk starts on a block boundary
+    const size_t             chunk_size = (((json_string.size() / parts_count) + SCAN_BLOCK_SIZE - 1u) / SCAN_BLOCK_SIZE) * SCAN_BLOCK_SIZE;
+    std::vector<chunk_scan>  scans(parts_count);
+    std::vector<std::thread> threads;
+    threads.reserve(parts_count - 1u);
+    for (size_t i = 1u; i < parts_count; i++)
+    {
+        threads.emplace_back(
+            scan_chunk, json_string, std::min(i * chunk_size, json_string.size()), std::min((i + 1u) * chunk_size, json_string.size()), std::ref(scans[i]));
+    }
+    scan_chunk(json_string, 0u, std::min(chunk_size, json_string.size()), scans[0u]);
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // The string state and the nesting level at the start of each chunk are known from the previous chunks,
+    // the chunks which don't contain a root separator are merged with the previous part
+    std::vector<size_t> parts;
+    parts.reserve(parts_count + 1u);
+    parts.push_back(0u);
+    size_t in_string = 0u;
+    int    depth     = 0;
+    for (size_t i = 0u; i < parts_count; i++)
+    {
+        const chunk_scan& scan = scans[i];
+        if ((i != 0u) && (depth >= 1) && (depth <= MAX_NESTING_LEVEL) && (scan.separators[in_string][depth - 1] != chunk_scan::NO_SEPARATOR))
+        {
+            parts.push_back(scan.separators[in_string][depth - 1] + 1u);
+        }
+        depth += scan.depth_delta[in_string];
+        in_string ^= (scan.odd_quotes ? 1u : 0u);
+    }
+    parts.push_back(json_string.size());
+
+    return parts;
+}
+
+/** @brief Find the brackets and the separators of a chunk of a json string */
+static void scan_chunk(const std::string_view& json_string, size_t chunk_start, size_t chunk_end, chunk_scan& scan)
+{
+    // The first char of the chunk is escaped if it follows an odd number of backslashes
+    bool escaped = false;
+    for (size_t i = chunk_start; (i != 0u) && (json_string[i - 1u] == '\\'); i--)
+    {
+        escaped = !escaped;
+    }
+
+    uint64_t in_string = 0u;
+    int      depth[2u] = {0, 0};
+    for (auto& separators : scan.separators)
+    {
+        std::fill(std::begin(separators), std::end(separators), chunk_scan::NO_SEPARATOR);
+    }
+    for (size_t block_start = chunk_start; block_start < chunk_end; block_start += SCAN_BLOCK_SIZE)
+    {
+        scan_block_masks masks;
+        const size_t     left = chunk_end - block_start;
+        if (left >= SCAN_BLOCK_SIZE)
+        {
+            masks = scan_block(&json_string[block_start]);
+        }
+        else
+        {
+            // Last block, pad with blank chars
+            char padded_block[SCAN_BLOCK_SIZE];
+            for (size_t i = 0u; i < SCAN_BLOCK_SIZE; i++)
+            {
+                padded_block[i] = ((i < left) ? json_string[block_start + i] : ' ');
+            }
+            masks = scan_block(padded_block);
+        }
+
+        // The structural chars outside the strings if the chunk starts outside a string are inside the strings otherwise
+        const uint64_t strings = get_string_chars(get_unescaped_quotes(masks, escaped), in_string);
+        for (size_t state = 0u; state < 2u; state++)
+        {
+            uint64_t structurals = (masks.structurals & ((state == 0u) ? ~strings : strings));
+            while (structurals != 0u)
+            {
+                const size_t position = block_start + count_trailing_zeros(structurals);
+                switch (json_string[position])
+                {
+                    case '{':
+                    case '[':
+                        depth[state]++;
+                        break;
+
+                    case '}':
+                    case ']':
+                        depth[state]--;
+                        break;
+
+                    case ',':
+                    {
+                        // Relative nesting level of a root separator = 1 - nesting level at the start of the chunk
+                        const int start_depth = 1 - depth[state];
+                        if ((start_depth >= 1) && (start_depth <= MAX_NESTING_LEVEL) &&
+                            (scan.separators[state][start_depth - 1] == chunk_scan::NO_SEPARATOR))
+                        {
+                            scan.separators[state][start_depth - 1] = position;
+                        }
+                    }
+                    break;
+
+                    default:
+                        break;
+                }
+                structurals &= (structurals - 1u);
+            }
+        }
+    }
+    scan.odd_quotes     = (in_string != 0u);
+    scan.depth_delta[0] = depth[0u];
+    scan.depth_delta[1] = depth[1u];
+}
+
+/** @brief Parse a part of a json string into its own part of the descriptors */
+static void parse_part(const std::string_view&           json_string,
+                       const std::span<json_value_desc>& descriptors,
+                       size_t                            part_start,
+                       size_t                            part_end,
+                       json_value_type                   root_type,
+                       part_result&                      result)
+{
+    // Errors are not reported, the json string will be parsed again to report them
+    no_error_handler                                  error_handler;
+    desc_value_handler                                value_handler(descriptors);
+    json_parser<no_error_handler, desc_value_handler> parser(error_handler, value_handler);
+    const bool                                        last_part = (part_end == json_string.size());
+    if (part_start == 0u)
+    {
+        parser.begin(json_string.data());
+    }
+    else
+    {
+        parser.begin_part(json_string.data(), part_start, root_type);
+    }
+    parser.resume(part_end, !last_part);
+
+    // The parts are linked if each of them ends exactly where the next one starts
+    result.success      = (last_part ? parser.is_complete() : parser.is_at_root_separator());
+    result.values_count = value_handler.get_values_count();
+    result.root_size    = (value_handler.is_started() ? value_handler.get_root_size() : 0u);
+}
+
+/** @brief Parse the chunks of a thread, then the chunks stolen from the other threads */
+static void parse_chunks(parallel_context& context, size_t thread_index)
+{
+    const size_t threads_count = context.queues.size();
+    size_t       chunk         = 0u;
+    bool         success       = true;
+    while (success && !context.failed && pop_chunk(context.queues[thread_index], chunk))
+    {
+        success = parse_chunk(context, thread_index, chunk);
+    }
+    for (size_t i = 1u; success && (i < threads_count); i++)
+    {
+        chunk_queue& queue = context.queues[(thread_index + i) % threads_count];
+        while (success && !context.failed && steal_chunk(queue, chunk))
+        {
+            success = parse_chunk(context, thread_index, chunk);
+        }
+    }
+}
+
+/** @brief Parse the documents of a chunk, returns false if an invalid document has been found */
+static bool parse_chunk(parallel_context& context, size_t thread_index, size_t chunk)
+{
+    // Each thread uses its own part of the descriptors
+    const size_t     descriptors_count = context.descriptors.size() / context.queues.size();
+    const size_t     chunk_start       = context.chunks[chunk];
+    json_size_t      error_index       = 0u;
+    json_parse_error error             = json_parse_error::no_error;
+    auto             documents         = parse_many(context.json_string.substr(chunk_start, context.chunks[chunk + 1u] - chunk_start),
+                                    context.descriptors.subspan(thread_index * descriptors_count, descriptors_count),
+                                    json_documents_storage::reuse,
+                                    [&error_index, &error](json_size_t _error_index, json_parse_error _error)
+                                    {
+                                        error_index = _error_index;
+                                        error       = _error;
+                                    });
+    for (auto document = documents.next(); document && !context.failed; document = documents.next())
+    {
+        document->offset += chunk_start;
+        context.document_handler(thread_index, document.value());
+    }
+
+    if (!documents.is_successful())
+    {
+        context.failed = true;
+        if (context.error_handler)
+        {
+            std::lock_guard<std::mutex> lock(context.error_mutex);
+            context.error_handler(chunk_start + documents.get_offset(), error_index, error);
+        }
+    }
+
+    return documents.is_successful();
+}
+
+/** @brief Get the next chunk of a thread */
+static bool pop_chunk(chunk_queue& queue, size_t& chunk)
+{
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    const bool                  available = (queue.first != queue.last);
+    if (available)
+    {
+        chunk = queue.first;
+        queue.first++;
+    }
+    return available;
+}
+
+/** @brief Steal the last chunk of another thread */
+static bool steal_chunk(chunk_queue& queue, size_t& chunk)
+{
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    const bool                  available = (queue.first != queue.last);
+    if (available)
+    {
+        queue.last--;
+        chunk = queue.last;
+    }
+    return available;
+}
+
+} // namespace nanojsoncpp
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2025 c-jimenez
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <nanojsoncpp/private/scan.h>
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define NANOJSONCPP_SCAN_X86
+#include <immintrin.h>
+#endif // (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+
+namespace nanojsoncpp
+{
+
+/**/
+/* ------------ Internal functions declaration ------------ */
+/**/
+
+/** @brief Classify the chars of a block using portable C++ code */
+static scan_block_masks scan_block_scalar(const char* block);
+
+#ifdef NANOJSONCPP_SCAN_X86
+
+/** @brief Classify the chars of a block using SSE2 instructions */
+static scan_block_masks scan_block_sse2(const char* block);
+
+/** @brief Classify the chars of a block using AVX2 instructions */
+static scan_block_masks scan_block_avx2(const char* block);
+
+#endif // NANOJSONCPP_SCAN_X86
+
+/**/
+/* ------------ API functions ------------ */
+/**/
+
+/** @brief Get the most efficient instruction set available on the running CPU */
+scan_isa get_scan_isa()
+{
+    static const scan_isa isa = []()
+    {
+        scan_isa detected = scan_isa::scalar;
+#ifdef NANOJSONCPP_SCAN_X86
+        // SSE2 is part of the x86-64 baseline
+        detected = scan_isa::sse2;
+        if (__builtin_cpu_supports("avx2"))
+        {
+            detected = scan_isa::avx2;
+        }
+#endif // NANOJSONCPP_SCAN_X86
+        return detected;
+    }();
+    return isa;
+}
+
+/** @brief Get the block classification function corresponding to an instruction set (fallback to scalar if not available) */
+scan_block_func_t get_scan_block_func(scan_isa isa)
+{
+    scan_block_func_t func = scan_block_scalar;
+
+#ifdef NANOJSONCPP_SCAN_X86
+    if (isa > get_scan_isa())
+    {
+        isa = get_scan_isa();
+    }
+    switch (isa)
+    {
+        case scan_isa::sse2:
+            func = scan_block_sse2;
+            break;
+
+        case scan_isa::avx2:
+            func = scan_block_avx2;
+            break;
+
+        default:
+            // Scalar
+            break;
+    }
+#else
+    (void)isa;
+#endif // NANOJSONCPP_SCAN_X86
+
+    return func;
+}
+
+/** @brief Classify the SCAN_BLOCK_SIZE chars of a block of json string using the most efficient instruction set available */
+scan_block_masks scan_block(const char* block)
+{
+    static const scan_block_func_t func = get_scan_block_func(get_scan_isa());
+    return func(block);
+}
+
+/**/
+/* ------------ Internal functions ------------ */
+/**/
+
+/** @brief Classify the chars of a block using portable C++ code */
+static scan_block_masks scan_block_scalar(const char* block)
+{
+    scan_block_masks masks = {0u, 0u, 0u, 0u};
+
+    for (size_t i = 0u; i < SCAN_BLOCK_SIZE; i++)
+    {
+        const uint64_t bit = (static_cast<uint64_t>(1u) << i);
+        switch (block[i])
+        {
+            case '"':
+                masks.quotes |= bit;
+                break;
+
+            case '\\':
+                masks.backslashes |= bit;
+                break;
+
+            case '{':
+            case '}':
+            case '[':
+            case ']':
+            case ':':
+            case ',':
+                masks.structurals |= bit;
+                break;
+
+            case ' ':
+            case '\t':
+            case '\r':
+            case '\n':
+                masks.blanks |= bit;
+                break;
+
+            default:
+                // Other char
+                break;
+        }
+    }
+
+    return masks;
+}
+
+#ifdef NANOJSONCPP_SCAN_X86
+
+/** @brief Classify the chars of a block using SSE2 instructions */
+static scan_block_masks scan_block_sse2(const char* block)
+{
+    scan_block_masks masks = {0u, 0u, 0u, 0u};
+
+    const __m128i quote         = _mm_set1_epi8('"');
+    const __m128i backslash     = _mm_set1_epi8('\\');
+    const __m128i lower_case    = _mm_set1_epi8(0x20);
+    const __m128i open_bracket  = _mm_set1_epi8('{');
+    const __m128i close_bracket = _mm_set1_epi8('}');
+    const __m128i colon         = _mm_set1_epi8(':');
+    const __m128i comma         = _mm_set1_epi8(',');
+    const __m128i space         = _mm_set1_epi8(' ');
+    const __m128i tab           = _mm_set1_epi8('\t');
+    const __m128i cr            = _mm_set1_epi8('\r');
+    const __m128i lf            = _mm_set1_epi8('\n');
+
+    for (size_t i = 0u; i < SCAN_BLOCK_SIZE; i += sizeof(__m128i))
+    {
+        const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i));
+
+        // '[' and ']' only differ from '{' and '}' by the 0x20 bit
+        const __m128i lowered     = _mm_or_si128(chars, lower_case);
+        const __m128i structurals = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(lowered, open_bracket), _mm_cmpeq_epi8(lowered, close_bracket)),
+                                                 _mm_or_si128(_mm_cmpeq_epi8(chars, colon), _mm_cmpeq_epi8(chars, comma)));
+        const __m128i blanks      = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chars, space), _mm_cmpeq_epi8(chars, tab)),
+                                            _mm_or_si128(_mm_cmpeq_epi8(chars, cr), _mm_cmpeq_epi8(chars, lf)));
+
+        masks.quotes |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, quote)))) << i;
+        masks.backslashes |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, backslash)))) << i;
+        masks.structurals |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(structurals))) << i;
+        masks.blanks |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(blanks))) << i;
+    }
+
+    return masks;
+}
+
+/** @brief Classify the chars of a block using AVX2 instructions */
+__attribute__((target("avx2"))) static scan_block_masks scan_block_avx2(const char* block)
+{
+    // Structural and blank chars are identified by looking up their low and high nibbles
+    // in 2 tables : a char belongs to a class when both lookups share a bit of this class
+    //  - bit 0 : ',' (0x2C)
+    //  - bit 1 : ':' (0x3A)
+    //  - bit 2 : '[' (0x5B), ']' (0x5D), '{' (0x7B), '}' (0x7D)
+    //  - bit 3 : ' ' (0x20)
+    //  - bit 4 : '\t' (0x09), '\n' (0x0A), '\r' (0x0D)
+    const __m256i low_nibbles  = _mm256_setr_epi8(0x08, 0, 0, 0, 0, 0, 0, 0, 0, 0x10, 0x12, 0x04, 0x01, 0x14, 0, 0,
+                                                 0x08, 0, 0, 0, 0, 0, 0, 0, 0, 0x10, 0x12, 0x04, 0x01, 0x14, 0, 0);
+    const __m256i high_nibbles = _mm256_setr_epi8(0x10, 0, 0x09, 0x02, 0, 0x04, 0, 0x04, 0, 0, 0, 0, 0, 0, 0, 0,
+                                                  0x10, 0, 0x09, 0x02, 0, 0x04, 0, 0x04, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i nibble_mask      = _mm256_set1_epi8(0x0F);
+    const __m256i structurals_bits = _mm256_set1_epi8(0x07);
+    const __m256i blanks_bits      = _mm256_set1_epi8(0x18);
+    const __m256i zero             = _mm256_setzero_si256();
+    const __m256i quote            = _mm256_set1_epi8('"');
+    const __m256i backslash        = _mm256_set1_epi8('\\');
+
+    const __m256i chars[2] = {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(block)),
+                              _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + sizeof(__m256i)))};
+    uint32_t      quotes[2];
+    uint32_t      backslashes[2];
+    uint32_t      structurals[2];
+    uint32_t      blanks[2];
+    for (size_t i = 0u; i < 2u; i++)
+    {
+        const __m256i low     = _mm256_shuffle_epi8(low_nibbles, _mm256_and_si256(chars[i], nibble_mask));
+        const __m256i high    = _mm256_shuffle_epi8(high_nibbles, _mm256_and_si256(_mm256_srli_epi16(chars[i], 4), nibble_mask));
+        const __m256i classes = _mm256_and_si256(low, high);
+
+        quotes[i]      = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chars[i], quote)));
+        backslashes[i] = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chars[i], backslash)));
+        structurals[i] = ~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(classes, structurals_bits), zero)));
+        blanks[i]      = ~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(classes, blanks_bits), zero)));
+    }
+
+    scan_block_masks masks;
+    masks.quotes      = (static_cast<uint64_t>(quotes[1u]) << 32u) | quotes[0u];
+    masks.backslashes = (static_cast<uint64_t>(backslashes[1u]) << 32u) | backslashes[0u];
+    masks.structurals = (static_cast<uint64_t>(structurals[1u]) << 32u) | structurals[0u];
+    masks.blanks      = (static_cast<uint64_t>(blanks[1u]) << 32u) | blanks[0u];
+    return masks;
+}
+
+#endif // NANOJSONCPP_SCAN_X86
+
+} // namespace nanojsoncpp
@@ -4,14 +4,150 @@
  */
 
 #include <nanojsoncpp/nanojsoncpp.h>
+#include <nanojsoncpp/private/digits.h>
+#include <nanojsoncpp/private/utf8.h>
 
 #ifdef NANOJSONCPP_USE_CPP17_FROM_CHARS_TO_CHARS
 #include <charconv>
+#else
+#include <cfloat>
+#include <cstdlib>
 #endif
 
 namespace nanojsoncpp
 {
 
+/**/
+/* ------------ Internal functions declaration ------------ */
+/**/
+
+/** @brief Get the char corresponding to a 1 char escape sequence (the char itself if the sequence is unknown) */
+static char get_escaped_char(char c);
+
+/** @brief Get the code of the \\uXXXX escaped char at the given position, returns false if it is incomplete or invalid */
+static bool get_unicode_escape(const char* position, const char* end, uint32_t& code);
+
+/** @brief Get the code point of the \\uXXXX escaped char at the given position, a high surrogate being combined with
+ *         the low surrogate following it, returns the number of chars used (0 if the escaped char is invalid)
+ */
+static size_t get_code_point(const char* position, const char* end, uint32_t& code_point);
+
+/** @brief Write the UTF-8 sequence of a code point, returns its size */
+static size_t write_utf8(uint32_t code_point, char* buffer);
+
+#ifndef NANOJSONCPP_USE_CPP17_FROM_CHARS_TO_CHARS
+
+/** @brief Maximum number of significant digits of a decimal value which always fit in a 64 bits integer */
+static constexpr size_t MAX_MANTISSA_DIGITS = 19u;
+
+/** @brief Decimal value split in its significant digits and its power of 10 : value = mantissa * 10^exponent */
+struct decimal_number
+{
+    /** @brief Start of the integer and fractional parts of the value */
+    const char* digits;
+    /** @brief End of the integer and fractional parts of the value */
+    const char* end_of_digits;
+    /** @brief First MAX_MANTISSA_DIGITS significant digits as an integer */
+    uint64_t mantissa;
+    /** @brief Power of 10 of the mantissa */
+    int64_t exponent;
+    /** @brief Indicate if non zero digits have been dropped from the mantissa */
+    bool truncated;
+    /** @brief Indicate if the value is negative */
+    bool negative;
+};
+
+/** @brief Characteristics of the IEEE 754 binary representation of a floating point type */
+template <typename FloatT>
+struct binary_format;
+
+/** @brief Characteristics of the IEEE 754 binary representation of double */
+template <>
+struct binary_format<double>
+{
+    /** @brief Integer type of the same size */
+    using bits_t = uint64_t;
+    /** @brief Number of explicit bits of the mantissa */
+    static constexpr int32_t MANTISSA_BITS = 52;
+    /** @brief Exponent bias */
+    static constexpr int32_t MIN_EXPONENT = -1023;
+    /** @brief Biased exponent of infinity */
+    static constexpr int32_t INFINITE_POWER = 0x7FF;
+    /** @brief Smallest power of 10 which can give a non zero value from a 64 bits mantissa */
+    static constexpr int32_t MIN_POWER_OF_TEN = -342;
+    /** @brief Biggest power of 10 which can give a finite value */
+    static constexpr int32_t MAX_POWER_OF_TEN = 308;
+    /** @brief Range of the powers of 10 which can give a value exactly halfway between 2 floating point values */
+    static constexpr int32_t MIN_ROUND_TO_EVEN = -4;
+    static constexpr int32_t MAX_ROUND_TO_EVEN = 23;
+    /** @brief Biggest power of 10 exactly represented */
+    static constexpr int32_t MAX_EXACT_POWER_OF_TEN = 22;
+    /** @brief Maximum number of significant digits of a value exactly halfway between 2 floating point values (+ 1) :
+     *         the following digits only need to be known as zero or not to round correctly
+     */
+    static constexpr size_t MAX_DECIMAL_DIGITS = 769u;
+};
+
+/** @brief Characteristics of the IEEE 754 binary representation of float */
+template <>
+struct binary_format<float>
+{
+    /** @brief Integer type of the same size */
+    using bits_t = uint32_t;
+    /** @brief Number of explicit bits of the mantissa */
+    static constexpr int32_t MANTISSA_BITS = 23;
+    /** @brief Exponent bias */
+    static constexpr int32_t MIN_EXPONENT = -127;
+    /** @brief Biased exponent of infinity */
+    static constexpr int32_t INFINITE_POWER = 0xFF;
+    /** @brief Smallest power of 10 which can give a non zero value from a 64 bits mantissa */
+    static constexpr int32_t MIN_POWER_OF_TEN = -65;
+    /** @brief Biggest power of 10 which can give a finite value */
+    static constexpr int32_t MAX_POWER_OF_TEN = 38;
+    /** @brief Range of the powers of 10 which can give a value exactly halfway between 2 floating point values */
+    static constexpr int32_t MIN_ROUND_TO_EVEN = -17;
+    static constexpr int32_t MAX_ROUND_TO_EVEN = 10;
+    /** @brief Biggest power of 10 exactly represented */
+    static constexpr int32_t MAX_EXACT_POWER_OF_TEN = 10;
+    /** @brief Maximum number of significant digits of a value exactly halfway between 2 floating point values (+ 1) :
+     *         the following digits only need to be known as zero or not to round correctly
+     */
+    static constexpr size_t MAX_DECIMAL_DIGITS = 114u;
+};
+
+/** @brief Split a decimal value represented as a string in its significant digits and its power of 10,
+ *         returns false if the string is not a valid number
+ */
+static bool get_decimal_number(const std::string_view& str, decimal_number& decimal);
+
+/** @brief Convert a decimal value to the closest floating point value */
+template <typename FloatT>
+static FloatT decimal_to_float(const decimal_number& decimal);
+
+/** @brief Compute the biased exponent and the mantissa of the floating point value closest to w * 10^q using the Eisel-Lemire algorithm,
+ *         returns false if the rounding can't be decided with the 64 bits approximation of the power of 10
+ */
+template <typename FloatT>
+static bool compute_float(uint64_t w, int64_t q, uint64_t& mantissa, int32_t& power2);
+
+/** @brief Convert the significant digits of a decimal value using the C library : slow but used only for the values
+ *         that the Eisel-Lemire algorithm can't round
+ */
+template <typename FloatT>
+static FloatT slow_decimal_to_float(const decimal_number& decimal);
+
+/** @brief Multiply 2 64 bits integers, returns the upper 64 bits of the result and stores the lower 64 bits in low */
+static uint64_t full_multiplication(uint64_t a, uint64_t b, uint64_t& low);
+
+/** @brief Count the leading zero bits of a non zero 64 bits integer */
+static int32_t count_leading_zeros(uint64_t value);
+
+#endif // NANOJSONCPP_USE_CPP17_FROM_CHARS_TO_CHARS
+
+/**/
+/* ------------ API functions ------------ */
+/**/
+
 /** @brief Convert an integer value represented as a string to an integer value */
 json_int_t to_int(const std::string_view& str)
 {
@@ -29,32 +165,21 @@ json_int_t to_int(const std::string_view& str)
     if (!str.empty())
     {
         // Check sign
-        json_int_t       sign = 1;
-        std::string_view sv   = str;
-        if (sv[0] == '-')
+        const char* start_of_digits = str.data();
+        const char* end             = str.data() + str.size();
+        const bool  negative        = (*start_of_digits == '-');
+        if (negative)
         {
-            sign = -1;
-            sv   = sv.substr(1u);
+            start_of_digits++;
         }
 
-        // Convert value
-        for (char c : sv)
+        // Convert value, 8 digits at a time
+        uint64_t value = 0u;
+        if (parse_digits(start_of_digits, end, value) == end)
         {
-            if (c >= '0' && c <= '9')
-            {
-                // Increment value
-                val = val * 10u + (c - '0');
-            }
-            else
-            {
-                // Invalid value
-                val = 0u;
-                break;
-            }
+            // Add sign
+            val = static_cast<json_int_t>(negative ? (0u - value) : value);
         }
-
-        // Add sign
-        val *= sign;
     }
 
 #endif // NANOJSONCPP_USE_CPP17_FROM_CHARS_TO_CHARS
@@ -73,59 +198,96 @@ json_float_t to_float(const std::string_view& str)
     std::from_chars(str.data(), str.data() + str.size(), val);
 
 #else
-    // Custom implementation
+    // Custom implementation : Eisel-Lemire algorithm with a fallback on the C library for the values it can't round
 
-    // Check empty value
-    if (!str.empty())
+    decimal_number decimal;
+    if (get_decimal_number(str, decimal))
     {
-        // Check sign
-        json_float_t     sign = 1.;
-        std::string_view sv   = str;
-        if (sv[0] == '-')
+        val = decimal_to_float<json_float_t>(decimal);
+    }
+
+#endif // NANOJSONCPP_USE_CPP17_FROM_CHARS_TO_CHARS
+
+    return val;
+}
+
+/** @brief Indicate if a json string value only contains ASCII chars, including the chars given by its \\uXXXX escaped chars */
+bool is_ascii(const std::string_view& str)
+{
+    const char* end      = str.data() + str.size();
+    const char* position = skip_ascii_chars(str.data(), end);
+    bool        ascii    = (position == end);
+
+    // Only the \\u escaped chars can give non ASCII chars
+    position = str.data();
+    while (ascii && (position != end))
+    {
+        position = static_cast<const char*>(memchr(position, '\\', static_cast<size_t>(end - position)));
+        if ((position != nullptr) && ((end - position) >= 2))
+        {
+            uint32_t     code_point = 0u;
+            const size_t size       = ((position[1u] == 'u') ? get_code_point(position, end, code_point) : 0u);
+            ascii                   = (code_point < 0x80u);
+            position += ((size != 0u) ? size : 2u);
+        }
+        else
         {
-            sign = -1.;
-            sv   = sv.substr(1u);
+            position = end;
         }
+    }
+
+    return ascii;
+}
 
-        // Look for decimal point
-        size_t index_point = 0u;
-        for (char c : sv)
+/** @brief Convert the escaped chars of a json string value, the \\uXXXX escaped chars being converted to UTF-8 :
+ *         the buffer must be at least as big as the string and can be the string itself,
+ *         returns the size of the converted string
+ */
+size_t unescape(const std::string_view& str, char* buffer)
+{
+    const char* position = str.data();
+    const char* end      = str.data() + str.size();
+    size_t      size     = 0u;
+    while (position != end)
+    {
+        // Copy the chars preceding the next escaped char at once
+        const char*  backslash = static_cast<const char*>(memchr(position, '\\', static_cast<size_t>(end - position)));
+        const char*  copy_end  = ((backslash != nullptr) ? backslash : end);
+        const size_t copy_size = static_cast<size_t>(copy_end - position);
+        memmove(&buffer[size], position, copy_size);
+        position = copy_end;
+        size += copy_size;
+
+        // Convert the escaped char
+        if ((end - position) >= 2)
         {
-            if (c == '.')
+            uint32_t code_point = 0u;
+            size_t   used       = 0u;
+            if (position[1u] == 'u')
             {
-                break;
+                used = get_code_point(position, end, code_point);
+            }
+            if (used != 0u)
+            {
+                // The UTF-8 sequence is never longer than the escaped char
+                size += write_utf8(code_point, &buffer[size]);
+                position += used;
             }
             else
             {
-                index_point++;
+                buffer[size] = get_escaped_char(position[1u]);
+                size++;
+                position += 2u;
             }
         }
-
-        // Get integer part
-        json_float_t int_part = static_cast<json_float_t>(to_int(sv.substr(0u, index_point)));
-
-        // Get the fractionnal part
-        json_float_t frac_part = 0.;
-        if ((index_point + 1u) < sv.size())
+        else
         {
-            std::string_view sv_frac = sv.substr(index_point + 1u);
-            frac_part                = static_cast<json_float_t>(to_int(sv_frac));
-
-            json_float_t div = 1.;
-            for ([[maybe_unused]] char c : sv_frac)
-            {
-                div *= static_cast<json_float_t>(10.);
-            }
-            frac_part = frac_part / div;
+            // Incomplete escaped char at the end of the string
+            position = end;
         }
-
-        // Compute value
-        val = (int_part + frac_part) * sign;
     }
 
-#endif // NANOJSONCPP_USE_CPP17_FROM_CHARS_TO_CHARS
-
-    return val;
+    return size;
 }
 
 /** @brief Convert an integer value to a string */
@@ -224,4 +386,604 @@ size_t to_string(json_float_t val, const std::span<char>& buff)
     return ret;
 }
 
+/**/
+/* ------------ Internal functions ------------ */
+/**/
+
+/** @brief Get the char corresponding to a 1 char escape sequence (the char itself if the sequence is unknown) */
+static char get_escaped_char(char c)
+{
+    char escaped_char = c;
+    switch (c)
+    {
+        case 'n':
+            escaped_char = '\n';
+            break;
+
+        case 'r':
+            escaped_char = '\r';
+            break;
+
+        case 'b':
+            escaped_char = '\b';
+            break;
+
+        case 'f':
+            escaped_char = '\f';
+            break;
+
+        case 't':
+            escaped_char = '\t';
+            break;
+
+        default:
+            // '\\', '/', '"' or unknown char, copied as-is
+            break;
+    }
+    return escaped_char;
+}
+
+/** @brief Get the code of the \\uXXXX escaped char at the given position, returns false if it is incomplete or invalid */
+static bool get_unicode_escape(const char* position, const char* end, uint32_t& code)
+{
+    bool valid = (((end - position) >= 6) && (position[0u] == '\\') && (position[1u] == 'u'));
+    code       = 0u;
+    for (size_t i = 2u; valid && (i < 6u); i++)
+    {
+        const uint8_t digit = get_hex_digit(position[i]);
+        code                = ((code << 4u) | digit);
+        valid               = (digit < 16u);
+    }
+    return valid;
+}
+
+/** @brief Get the code point of the \\uXXXX escaped char at the given position, a high surrogate being combined with
+ *         the low surrogate following it, returns the number of chars used (0 if the escaped char is invalid)
+ */
+static size_t get_code_point(const char* position, const char* end, uint32_t& code_point)
+{
+    size_t size = 0u;
+    if (get_unicode_escape(position, end, code_point))
+    {
+        uint32_t low_surrogate = 0u;
+        if ((code_point < 0xD800u) || (code_point > 0xDFFFu))
+        {
+            size = 6u;
+        }
+        else if ((code_point <= 0xDBFFu) && get_unicode_escape(position + 6u, end, low_surrogate) && (low_surrogate >= 0xDC00u) &&
+                 (low_surrogate <= 0xDFFFu))
+        {
+            code_point = 0x10000u + (((code_point - 0xD800u) << 10u) | (low_surrogate - 0xDC00u));
+            size       = 12u;
+        }
+        else
+        {
+            // Lone surrogate
+        }
+    }
+    return size;
+}
+
+/** @brief Write the UTF-8 sequence of a code point, returns its size */
+static size_t write_utf8(uint32_t code_point, char* buffer)
+{
+    size_t size = 0u;
+    if (code_point < 0x80u)
+    {
+        buffer[0u] = static_cast<char>(code_point);
+        size       = 1u;
+    }
+    else if (code_point < 0x800u)
+    {
+        buffer[0u] = static_cast<char>(0xC0u | (code_point >> 6u));
+        buffer[1u] = static_cast<char>(0x80u | (code_point & 0x3Fu));
+        size       = 2u;
+    }
+    else if (code_point < 0x10000u)
+    {
+        buffer[0u] = static_cast<char>(0xE0u | (code_point >> 12u));
+        buffer[1u] = static_cast<char>(0x80u | ((code_point >> 6u) & 0x3Fu));
+        buffer[2u] = static_cast<char>(0x80u | (code_point & 0x3Fu));
+        size       = 3u;
+    }
+    else
+    {
+        buffer[0u] = static_cast<char>(0xF0u | (code_point >> 18u));
+        buffer[1u] = static_cast<char>(0x80u | ((code_point >> 12u) & 0x3Fu));
+        buffer[2u] = static_cast<char>(0x80u | ((code_point >> 6u) & 0x3Fu));
+        buffer[3u] = static_cast<char>(0x80u | (code_point & 0x3Fu));
+        size       = 4u;
+    }
+    return size;
+}
+
+#ifndef NANOJSONCPP_USE_CPP17_FROM_CHARS_TO_CHARS
+
+/** @brief Powers of 10 exactly represented by a double */
+static constexpr double EXACT_POWERS_OF_TEN[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                                 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+/** @brief Upper 64 bits of the powers of 5 from 5^-342 to 5^308, normalized so that their most significant bit is set */
+static constexpr uint64_t POWERS_OF_FIVE[] = {
+    0xEEF453D6923BD65Aull, 0x9558B4661B6565F8ull, 0xBAAEE17FA23EBF76ull, 0xE95A99DF8ACE6F53ull, 0x91D8A02BB6C10594ull, 0xB64EC836A47146F9ull,
+    0xE3E27A444D8D98B7ull, 0x8E6D8C6AB0787F72ull, 0xB208EF855C969F4Full, 0xDE8B2B66B3BC4723ull, 0x8B16FB203055AC76ull, 0xADDCB9E83C6B1793ull,
+    0xD953E8624B85DD78ull, 0x87D4713D6F33AA6Bull, 0xA9C98D8CCB009506ull, 0xD43BF0EFFDC0BA48ull, 0x84A57695FE98746Dull, 0xA5CED43B7E3E9188ull,
+    0xCF42894A5DCE35EAull, 0x818995CE7AA0E1B2ull, 0xA1EBFB4219491A1Full, 0xCA66FA129F9B60A6ull, 0xFD00B897478238D0ull, 0x9E20735E8CB16382ull,
+    0xC5A890362FDDBC62ull, 0xF712B443BBD52B7Bull, 0x9A6BB0AA55653B2Dull, 0xC1069CD4EABE89F8ull, 0xF148440A256E2C76ull, 0x96CD2A865764DBCAull,
+    0xBC807527ED3E12BCull, 0xEBA09271E88D976Bull, 0x93445B8731587EA3ull, 0xB8157268FDAE9E4Cull, 0xE61ACF033D1A45DFull, 0x8FD0C16206306BABull,
+    0xB3C4F1BA87BC8696ull, 0xE0B62E2929ABA83Cull, 0x8C71DCD9BA0B4925ull, 0xAF8E5410288E1B6Full, 0xDB71E91432B1A24Aull, 0x892731AC9FAF056Eull,
+    0xAB70FE17C79AC6CAull, 0xD64D3D9DB981787Dull, 0x85F0468293F0EB4Eull, 0xA76C582338ED2621ull, 0xD1476E2C07286FAAull, 0x82CCA4DB847945CAull,
+    0xA37FCE126597973Cull, 0xCC5FC196FEFD7D0Cull, 0xFF77B1FCBEBCDC4Full, 0x9FAACF3DF73609B1ull, 0xC795830D75038C1Dull, 0xF97AE3D0D2446F25ull,
+    0x9BECCE62836AC577ull, 0xC2E801FB244576D5ull, 0xF3A20279ED56D48Aull, 0x9845418C345644D6ull, 0xBE5691EF416BD60Cull, 0xEDEC366B11C6CB8Full,
+    0x94B3A202EB1C3F39ull, 0xB9E08A83A5E34F07ull, 0xE858AD248F5C22C9ull, 0x91376C36D99995BEull, 0xB58547448FFFFB2Dull, 0xE2E69915B3FFF9F9ull,
+    0x8DD01FAD907FFC3Bull, 0xB1442798F49FFB4Aull, 0xDD95317F31C7FA1Dull, 0x8A7D3EEF7F1CFC52ull, 0xAD1C8EAB5EE43B66ull, 0xD863B256369D4A40ull,
+    0x873E4F75E2224E68ull, 0xA90DE3535AAAE202ull, 0xD3515C2831559A83ull, 0x8412D9991ED58091ull, 0xA5178FFF668AE0B6ull, 0xCE5D73FF402D98E3ull,
+    0x80FA687F881C7F8Eull, 0xA139029F6A239F72ull, 0xC987434744AC874Eull, 0xFBE9141915D7A922ull, 0x9D71AC8FADA6C9B5ull, 0xC4CE17B399107C22ull,
+    0xF6019DA07F549B2Bull, 0x99C102844F94E0FBull, 0xC0314325637A1939ull, 0xF03D93EEBC589F88ull, 0x96267C7535B763B5ull, 0xBBB01B9283253CA2ull,
+    0xEA9C227723EE8BCBull, 0x92A1958A7675175Full, 0xB749FAED14125D36ull, 0xE51C79A85916F484ull, 0x8F31CC0937AE58D2ull, 0xB2FE3F0B8599EF07ull,
+    0xDFBDCECE67006AC9ull, 0x8BD6A141006042BDull, 0xAECC49914078536Dull, 0xDA7F5BF590966848ull, 0x888F99797A5E012Dull, 0xAAB37FD7D8F58178ull,
+    0xD5605FCDCF32E1D6ull, 0x855C3BE0A17FCD26ull, 0xA6B34AD8C9DFC06Full, 0xD0601D8EFC57B08Bull, 0x823C12795DB6CE57ull, 0xA2CB1717B52481EDull,
+    0xCB7DDCDDA26DA268ull, 0xFE5D54150B090B02ull, 0x9EFA548D26E5A6E1ull, 0xC6B8E9B0709F109Aull, 0xF867241C8CC6D4C0ull, 0x9B407691D7FC44F8ull,
+    0xC21094364DFB5636ull, 0xF294B943E17A2BC4ull, 0x979CF3CA6CEC5B5Aull, 0xBD8430BD08277231ull, 0xECE53CEC4A314EBDull, 0x940F4613AE5ED136ull,
+    0xB913179899F68584ull, 0xE757DD7EC07426E5ull, 0x9096EA6F3848984Full, 0xB4BCA50B065ABE63ull, 0xE1EBCE4DC7F16DFBull, 0x8D3360F09CF6E4BDull,
+    0xB080392CC4349DECull, 0xDCA04777F541C567ull, 0x89E42CAAF9491B60ull, 0xAC5D37D5B79B6239ull, 0xD77485CB25823AC7ull, 0x86A8D39EF77164BCull,
+    0xA8530886B54DBDEBull, 0xD267CAA862A12D66ull, 0x8380DEA93DA4BC60ull, 0xA46116538D0DEB78ull, 0xCD795BE870516656ull, 0x806BD9714632DFF6ull,
+    0xA086CFCD97BF97F3ull, 0xC8A883C0FDAF7DF0ull, 0xFAD2A4B13D1B5D6Cull, 0x9CC3A6EEC6311A63ull, 0xC3F490AA77BD60FCull, 0xF4F1B4D515ACB93Bull,
+    0x991711052D8BF3C5ull, 0xBF5CD54678EEF0B6ull, 0xEF340A98172AACE4ull, 0x9580869F0E7AAC0Eull, 0xBAE0A846D2195712ull, 0xE998D258869FACD7ull,
+    0x91FF83775423CC06ull, 0xB67F6455292CBF08ull, 0xE41F3D6A7377EECAull, 0x8E938662882AF53Eull, 0xB23867FB2A35B28Dull, 0xDEC681F9F4C31F31ull,
+    0x8B3C113C38F9F37Eull, 0xAE0B158B4738705Eull, 0xD98DDAEE19068C76ull, 0x87F8A8D4CFA417C9ull, 0xA9F6D30A038D1DBCull, 0xD47487CC8470652Bull,
+    0x84C8D4DFD2C63F3Bull, 0xA5FB0A17C777CF09ull, 0xCF79CC9DB955C2CCull, 0x81AC1FE293D599BFull, 0xA21727DB38CB002Full, 0xCA9CF1D206FDC03Bull,
+    0xFD442E4688BD304Aull, 0x9E4A9CEC15763E2Eull, 0xC5DD44271AD3CDBAull, 0xF7549530E188C128ull, 0x9A94DD3E8CF578B9ull, 0xC13A148E3032D6E7ull,
+    0xF18899B1BC3F8CA1ull, 0x96F5600F15A7B7E5ull, 0xBCB2B812DB11A5DEull, 0xEBDF661791D60F56ull, 0x936B9FCEBB25C995ull, 0xB84687C269EF3BFBull,
+    0xE65829B3046B0AFAull, 0x8FF71A0FE2C2E6DCull, 0xB3F4E093DB73A093ull, 0xE0F218B8D25088B8ull, 0x8C974F7383725573ull, 0xAFBD2350644EEACFull,
+    0xDBAC6C247D62A583ull, 0x894BC396CE5DA772ull, 0xAB9EB47C81F5114Full, 0xD686619BA27255A2ull, 0x8613FD0145877585ull, 0xA798FC4196E952E7ull,
+    0xD17F3B51FCA3A7A0ull, 0x82EF85133DE648C4ull, 0xA3AB66580D5FDAF5ull, 0xCC963FEE10B7D1B3ull, 0xFFBBCFE994E5C61Full, 0x9FD561F1FD0F9BD3ull,
+    0xC7CABA6E7C5382C8ull, 0xF9BD690A1B68637Bull, 0x9C1661A651213E2Dull, 0xC31BFA0FE5698DB8ull, 0xF3E2F893DEC3F126ull, 0x986DDB5C6B3A76B7ull,
+    0xBE89523386091465ull, 0xEE2BA6C0678B597Full, 0x94DB483840B717EFull, 0xBA121A4650E4DDEBull, 0xE896A0D7E51E1566ull, 0x915E2486EF32CD60ull,
+    0xB5B5ADA8AAFF80B8ull, 0xE3231912D5BF60E6ull, 0x8DF5EFABC5979C8Full, 0xB1736B96B6FD83B3ull, 0xDDD0467C64BCE4A0ull, 0x8AA22C0DBEF60EE4ull,
+    0xAD4AB7112EB3929Dull, 0xD89D64D57A607744ull, 0x87625F056C7C4A8Bull, 0xA93AF6C6C79B5D2Dull, 0xD389B47879823479ull, 0x843610CB4BF160CBull,
+    0xA54394FE1EEDB8FEull, 0xCE947A3DA6A9273Eull, 0x811CCC668829B887ull, 0xA163FF802A3426A8ull, 0xC9BCFF6034C13052ull, 0xFC2C3F3841F17C67ull,
+    0x9D9BA7832936EDC0ull, 0xC5029163F384A931ull, 0xF64335BCF065D37Dull, 0x99EA0196163FA42Eull, 0xC06481FB9BCF8D39ull, 0xF07DA27A82C37088ull,
+    0x964E858C91BA2655ull, 0xBBE226EFB628AFEAull, 0xEADAB0ABA3B2DBE5ull, 0x92C8AE6B464FC96Full, 0xB77ADA0617E3BBCBull, 0xE55990879DDCAABDull,
+    0x8F57FA54C2A9EAB6ull, 0xB32DF8E9F3546564ull, 0xDFF9772470297EBDull, 0x8BFBEA76C619EF36ull, 0xAEFAE51477A06B03ull, 0xDAB99E59958885C4ull,
+    0x88B402F7FD75539Bull, 0xAAE103B5FCD2A881ull, 0xD59944A37C0752A2ull, 0x857FCAE62D8493A5ull, 0xA6DFBD9FB8E5B88Eull, 0xD097AD07A71F26B2ull,
+    0x825ECC24C873782Full, 0xA2F67F2DFA90563Bull, 0xCBB41EF979346BCAull, 0xFEA126B7D78186BCull, 0x9F24B832E6B0F436ull, 0xC6EDE63FA05D3143ull,
+    0xF8A95FCF88747D94ull, 0x9B69DBE1B548CE7Cull, 0xC24452DA229B021Bull, 0xF2D56790AB41C2A2ull, 0x97C560BA6B0919A5ull, 0xBDB6B8E905CB600Full,
+    0xED246723473E3813ull, 0x9436C0760C86E30Bull, 0xB94470938FA89BCEull, 0xE7958CB87392C2C2ull, 0x90BD77F3483BB9B9ull, 0xB4ECD5F01A4AA828ull,
+    0xE2280B6C20DD5232ull, 0x8D590723948A535Full, 0xB0AF48EC79ACE837ull, 0xDCDB1B2798182244ull, 0x8A08F0F8BF0F156Bull, 0xAC8B2D36EED2DAC5ull,
+    0xD7ADF884AA879177ull, 0x86CCBB52EA94BAEAull, 0xA87FEA27A539E9A5ull, 0xD29FE4B18E88640Eull, 0x83A3EEEEF9153E89ull, 0xA48CEAAAB75A8E2Bull,
+    0xCDB02555653131B6ull, 0x808E17555F3EBF11ull, 0xA0B19D2AB70E6ED6ull, 0xC8DE047564D20A8Bull, 0xFB158592BE068D2Eull, 0x9CED737BB6C4183Dull,
+    0xC428D05AA4751E4Cull, 0xF53304714D9265DFull, 0x993FE2C6D07B7FABull, 0xBF8FDB78849A5F96ull, 0xEF73D256A5C0F77Cull, 0x95A8637627989AADull,
+    0xBB127C53B17EC159ull, 0xE9D71B689DDE71AFull, 0x9226712162AB070Dull, 0xB6B00D69BB55C8D1ull, 0xE45C10C42A2B3B05ull, 0x8EB98A7A9A5B04E3ull,
+    0xB267ED1940F1C61Cull, 0xDF01E85F912E37A3ull, 0x8B61313BBABCE2C6ull, 0xAE397D8AA96C1B77ull, 0xD9C7DCED53C72255ull, 0x881CEA14545C7575ull,
+    0xAA242499697392D2ull, 0xD4AD2DBFC3D07787ull, 0x84EC3C97DA624AB4ull, 0xA6274BBDD0FADD61ull, 0xCFB11EAD453994BAull, 0x81CEB32C4B43FCF4ull,
+    0xA2425FF75E14FC31ull, 0xCAD2F7F5359A3B3Eull, 0xFD87B5F28300CA0Dull, 0x9E74D1B791E07E48ull, 0xC612062576589DDAull, 0xF79687AED3EEC551ull,
+    0x9ABE14CD44753B52ull, 0xC16D9A0095928A27ull, 0xF1C90080BAF72CB1ull, 0x971DA05074DA7BEEull, 0xBCE5086492111AEAull, 0xEC1E4A7DB69561A5ull,
+    0x9392EE8E921D5D07ull, 0xB877AA3236A4B449ull, 0xE69594BEC44DE15Bull, 0x901D7CF73AB0ACD9ull, 0xB424DC35095CD80Full, 0xE12E13424BB40E13ull,
+    0x8CBCCC096F5088CBull, 0xAFEBFF0BCB24AAFEull, 0xDBE6FECEBDEDD5BEull, 0x89705F4136B4A597ull, 0xABCC77118461CEFCull, 0xD6BF94D5E57A42BCull,
+    0x8637BD05AF6C69B5ull, 0xA7C5AC471B478423ull, 0xD1B71758E219652Bull, 0x83126E978D4FDF3Bull, 0xA3D70A3D70A3D70Aull, 0xCCCCCCCCCCCCCCCCull,
+    0x8000000000000000ull, 0xA000000000000000ull, 0xC800000000000000ull, 0xFA00000000000000ull, 0x9C40000000000000ull, 0xC350000000000000ull,
+    0xF424000000000000ull, 0x9896800000000000ull, 0xBEBC200000000000ull, 0xEE6B280000000000ull, 0x9502F90000000000ull, 0xBA43B74000000000ull,
+    0xE8D4A51000000000ull, 0x9184E72A00000000ull, 0xB5E620F480000000ull, 0xE35FA931A0000000ull, 0x8E1BC9BF04000000ull, 0xB1A2BC2EC5000000ull,
+    0xDE0B6B3A76400000ull, 0x8AC7230489E80000ull, 0xAD78EBC5AC620000ull, 0xD8D726B7177A8000ull, 0x878678326EAC9000ull, 0xA968163F0A57B400ull,
+    0xD3C21BCECCEDA100ull, 0x84595161401484A0ull, 0xA56FA5B99019A5C8ull, 0xCECB8F27F4200F3Aull, 0x813F3978F8940984ull, 0xA18F07D736B90BE5ull,
+    0xC9F2C9CD04674EDEull, 0xFC6F7C4045812296ull, 0x9DC5ADA82B70B59Dull, 0xC5371912364CE305ull, 0xF684DF56C3E01BC6ull, 0x9A130B963A6C115Cull,
+    0xC097CE7BC90715B3ull, 0xF0BDC21ABB48DB20ull, 0x96769950B50D88F4ull, 0xBC143FA4E250EB31ull, 0xEB194F8E1AE525FDull, 0x92EFD1B8D0CF37BEull,
+    0xB7ABC627050305ADull, 0xE596B7B0C643C719ull, 0x8F7E32CE7BEA5C6Full, 0xB35DBF821AE4F38Bull, 0xE0352F62A19E306Eull, 0x8C213D9DA502DE45ull,
+    0xAF298D050E4395D6ull, 0xDAF3F04651D47B4Cull, 0x88D8762BF324CD0Full, 0xAB0E93B6EFEE0053ull, 0xD5D238A4ABE98068ull, 0x85A36366EB71F041ull,
+    0xA70C3C40A64E6C51ull, 0xD0CF4B50CFE20765ull, 0x82818F1281ED449Full, 0xA321F2D7226895C7ull, 0xCBEA6F8CEB02BB39ull, 0xFEE50B7025C36A08ull,
+    0x9F4F2726179A2245ull, 0xC722F0EF9D80AAD6ull, 0xF8EBAD2B84E0D58Bull, 0x9B934C3B330C8577ull, 0xC2781F49FFCFA6D5ull, 0xF316271C7FC3908Aull,
+    0x97EDD871CFDA3A56ull, 0xBDE94E8E43D0C8ECull, 0xED63A231D4C4FB27ull, 0x945E455F24FB1CF8ull, 0xB975D6B6EE39E436ull, 0xE7D34C64A9C85D44ull,
+    0x90E40FBEEA1D3A4Aull, 0xB51D13AEA4A488DDull, 0xE264589A4DCDAB14ull, 0x8D7EB76070A08AECull, 0xB0DE65388CC8ADA8ull, 0xDD15FE86AFFAD912ull,
+    0x8A2DBF142DFCC7ABull, 0xACB92ED9397BF996ull, 0xD7E77A8F87DAF7FBull, 0x86F0AC99B4E8DAFDull, 0xA8ACD7C0222311BCull, 0xD2D80DB02AABD62Bull,
+    0x83C7088E1AAB65DBull, 0xA4B8CAB1A1563F52ull, 0xCDE6FD5E09ABCF26ull, 0x80B05E5AC60B6178ull, 0xA0DC75F1778E39D6ull, 0xC913936DD571C84Cull,
+    0xFB5878494ACE3A5Full, 0x9D174B2DCEC0E47Bull, 0xC45D1DF942711D9Aull, 0xF5746577930D6500ull, 0x9968BF6ABBE85F20ull, 0xBFC2EF456AE276E8ull,
+    0xEFB3AB16C59B14A2ull, 0x95D04AEE3B80ECE5ull, 0xBB445DA9CA61281Full, 0xEA1575143CF97226ull, 0x924D692CA61BE758ull, 0xB6E0C377CFA2E12Eull,
+    0xE498F455C38B997Aull, 0x8EDF98B59A373FECull, 0xB2977EE300C50FE7ull, 0xDF3D5E9BC0F653E1ull, 0x8B865B215899F46Cull, 0xAE67F1E9AEC07187ull,
+    0xDA01EE641A708DE9ull, 0x884134FE908658B2ull, 0xAA51823E34A7EEDEull, 0xD4E5E2CDC1D1EA96ull, 0x850FADC09923329Eull, 0xA6539930BF6BFF45ull,
+    0xCFE87F7CEF46FF16ull, 0x81F14FAE158C5F6Eull, 0xA26DA3999AEF7749ull, 0xCB090C8001AB551Cull, 0xFDCB4FA002162A63ull, 0x9E9F11C4014DDA7Eull,
+    0xC646D63501A1511Dull, 0xF7D88BC24209A565ull, 0x9AE757596946075Full, 0xC1A12D2FC3978937ull, 0xF209787BB47D6B84ull, 0x9745EB4D50CE6332ull,
+    0xBD176620A501FBFFull, 0xEC5D3FA8CE427AFFull, 0x93BA47C980E98CDFull, 0xB8A8D9BBE123F017ull, 0xE6D3102AD96CEC1Dull, 0x9043EA1AC7E41392ull,
+    0xB454E4A179DD1877ull, 0xE16A1DC9D8545E94ull, 0x8CE2529E2734BB1Dull, 0xB01AE745B101E9E4ull, 0xDC21A1171D42645Dull, 0x899504AE72497EBAull,
+    0xABFA45DA0EDBDE69ull, 0xD6F8D7509292D603ull, 0x865B86925B9BC5C2ull, 0xA7F26836F282B732ull, 0xD1EF0244AF2364FFull, 0x8335616AED761F1Full,
+    0xA402B9C5A8D3A6E7ull, 0xCD036837130890A1ull, 0x802221226BE55A64ull, 0xA02AA96B06DEB0FDull, 0xC83553C5C8965D3Dull, 0xFA42A8B73ABBF48Cull,
+    0x9C69A97284B578D7ull, 0xC38413CF25E2D70Dull, 0xF46518C2EF5B8CD1ull, 0x98BF2F79D5993802ull, 0xBEEEFB584AFF8603ull, 0xEEAABA2E5DBF6784ull,
+    0x952AB45CFA97A0B2ull, 0xBA756174393D88DFull, 0xE912B9D1478CEB17ull, 0x91ABB422CCB812EEull, 0xB616A12B7FE617AAull, 0xE39C49765FDF9D94ull,
+    0x8E41ADE9FBEBC27Dull, 0xB1D219647AE6B31Cull, 0xDE469FBD99A05FE3ull, 0x8AEC23D680043BEEull, 0xADA72CCC20054AE9ull, 0xD910F7FF28069DA4ull,
+    0x87AA9AFF79042286ull, 0xA99541BF57452B28ull, 0xD3FA922F2D1675F2ull, 0x847C9B5D7C2E09B7ull, 0xA59BC234DB398C25ull, 0xCF02B2C21207EF2Eull,
+    0x8161AFB94B44F57Dull, 0xA1BA1BA79E1632DCull, 0xCA28A291859BBF93ull, 0xFCB2CB35E702AF78ull, 0x9DEFBF01B061ADABull, 0xC56BAEC21C7A1916ull,
+    0xF6C69A72A3989F5Bull, 0x9A3C2087A63F6399ull, 0xC0CB28A98FCF3C7Full, 0xF0FDF2D3F3C30B9Full, 0x969EB7C47859E743ull, 0xBC4665B596706114ull,
+    0xEB57FF22FC0C7959ull, 0x9316FF75DD87CBD8ull, 0xB7DCBF5354E9BECEull, 0xE5D3EF282A242E81ull, 0x8FA475791A569D10ull, 0xB38D92D760EC4455ull,
+    0xE070F78D3927556Aull, 0x8C469AB843B89562ull, 0xAF58416654A6BABBull, 0xDB2E51BFE9D0696Aull, 0x88FCF317F22241E2ull, 0xAB3C2FDDEEAAD25Aull,
+    0xD60B3BD56A5586F1ull, 0x85C7056562757456ull, 0xA738C6BEBB12D16Cull, 0xD106F86E69D785C7ull, 0x82A45B450226B39Cull, 0xA34D721642B06084ull,
+    0xCC20CE9BD35C78A5ull, 0xFF290242C83396CEull, 0x9F79A169BD203E41ull, 0xC75809C42C684DD1ull, 0xF92E0C3537826145ull, 0x9BBCC7A142B17CCBull,
+    0xC2ABF989935DDBFEull, 0xF356F7EBF83552FEull, 0x98165AF37B2153DEull, 0xBE1BF1B059E9A8D6ull, 0xEDA2EE1C7064130Cull, 0x9485D4D1C63E8BE7ull,
+    0xB9A74A0637CE2EE1ull, 0xE8111C87C5C1BA99ull, 0x910AB1D4DB9914A0ull, 0xB54D5E4A127F59C8ull, 0xE2A0B5DC971F303Aull, 0x8DA471A9DE737E24ull,
+    0xB10D8E1456105DADull, 0xDD50F1996B947518ull, 0x8A5296FFE33CC92Full, 0xACE73CBFDC0BFB7Bull, 0xD8210BEFD30EFA5Aull, 0x8714A775E3E95C78ull,
+    0xA8D9D1535CE3B396ull, 0xD31045A8341CA07Cull, 0x83EA2B892091E44Dull, 0xA4E4B66B68B65D60ull, 0xCE1DE40642E3F4B9ull, 0x80D2AE83E9CE78F3ull,
+    0xA1075A24E4421730ull, 0xC94930AE1D529CFCull, 0xFB9B7CD9A4A7443Cull, 0x9D412E0806E88AA5ull, 0xC491798A08A2AD4Eull, 0xF5B5D7EC8ACB58A2ull,
+    0x9991A6F3D6BF1765ull, 0xBFF610B0CC6EDD3Full, 0xEFF394DCFF8A948Eull, 0x95F83D0A1FB69CD9ull, 0xBB764C4CA7A4440Full, 0xEA53DF5FD18D5513ull,
+    0x92746B9BE2F8552Cull, 0xB7118682DBB66A77ull, 0xE4D5E82392A40515ull, 0x8F05B1163BA6832Dull, 0xB2C71D5BCA9023F8ull, 0xDF78E4B2BD342CF6ull,
+    0x8BAB8EEFB6409C1Aull, 0xAE9672ABA3D0C320ull, 0xDA3C0F568CC4F3E8ull, 0x8865899617FB1871ull, 0xAA7EEBFB9DF9DE8Dull, 0xD51EA6FA85785631ull,
+    0x8533285C936B35DEull, 0xA67FF273B8460356ull, 0xD01FEF10A657842Cull, 0x8213F56A67F6B29Bull, 0xA298F2C501F45F42ull, 0xCB3F2F7642717713ull,
+    0xFE0EFB53D30DD4D7ull, 0x9EC95D1463E8A506ull, 0xC67BB4597CE2CE48ull, 0xF81AA16FDC1B81DAull, 0x9B10A4E5E9913128ull, 0xC1D4CE1F63F57D72ull,
+    0xF24A01A73CF2DCCFull, 0x976E41088617CA01ull, 0xBD49D14AA79DBC82ull, 0xEC9C459D51852BA2ull, 0x93E1AB8252F33B45ull, 0xB8DA1662E7B00A17ull,
+    0xE7109BFBA19C0C9Dull, 0x906A617D450187E2ull, 0xB484F9DC9641E9DAull, 0xE1A63853BBD26451ull, 0x8D07E33455637EB2ull, 0xB049DC016ABC5E5Full,
+    0xDC5C5301C56B75F7ull, 0x89B9B3E11B6329BAull, 0xAC2820D9623BF429ull, 0xD732290FBACAF133ull, 0x867F59A9D4BED6C0ull, 0xA81F301449EE8C70ull,
+    0xD226FC195C6A2F8Cull, 0x83585D8FD9C25DB7ull, 0xA42E74F3D032F525ull, 0xCD3A1230C43FB26Full, 0x80444B5E7AA7CF85ull, 0xA0555E361951C366ull,
+    0xC86AB5C39FA63440ull, 0xFA856334878FC150ull, 0x9C935E00D4B9D8D2ull, 0xC3B8358109E84F07ull, 0xF4A642E14C6262C8ull, 0x98E7E9CCCFBD7DBDull,
+    0xBF21E44003ACDD2Cull, 0xEEEA5D5004981478ull, 0x95527A5202DF0CCBull, 0xBAA718E68396CFFDull, 0xE950DF20247C83FDull, 0x91D28B7416CDD27Eull,
+    0xB6472E511C81471Dull, 0xE3D8F9E563A198E5ull, 0x8E679C2F5E44FF8Full
+};
+
+/** @brief Split a decimal value represented as a string in its significant digits and its power of 10,
+ *         returns false if the string is not a valid number
+ */
+static bool get_decimal_number(const std::string_view& str, decimal_number& decimal)
+{
+    const char* position = str.data();
+    const char* end      = str.data() + str.size();
+
+    decimal.negative = ((position != end) && (*position == '-'));
+    if (decimal.negative)
+    {
+        position++;
+    }
+
+    // Integer part
+    uint64_t mantissa = 0u;
+    decimal.digits    = position;
+    position          = parse_digits(position, end, mantissa);
+    size_t digits_count = static_cast<size_t>(position - decimal.digits);
+    bool   valid        = (digits_count != 0u);
+
+    // Fractional part
+    int64_t exponent = 0;
+    if ((position != end) && (*position == '.'))
+    {
+        position++;
+        const char* start_of_fraction = position;
+        position                      = parse_digits(position, end, mantissa);
+        exponent = static_cast<int64_t>(start_of_fraction - position);
+        digits_count += static_cast<size_t>(position - start_of_fraction);
+        valid = (valid || (position != start_of_fraction));
+    }
+    decimal.end_of_digits = position;
+
+    // Exponent
+    if (valid && (position != end) && ((*position == 'e') || (*position == 'E')))
+    {
+        position++;
+        const bool negative_exponent = ((position != end) && (*position == '-'));
+        if ((position != end) && ((*position == '-') || (*position == '+')))
+        {
+            position++;
+        }
+        const char* start_of_exponent = position;
+        int64_t     explicit_exponent = 0;
+        while ((position != end) && (*position >= '0') && (*position <= '9'))
+        {
+            // Saturate huge exponents which give 0 or infinity anyway
+            if (explicit_exponent < 100000000)
+            {
+                explicit_exponent = explicit_exponent * 10 + (*position - '0');
+            }
+            position++;
+        }
+        exponent += (negative_exponent ? -explicit_exponent : explicit_exponent);
+        valid = (position != start_of_exponent);
+    }
+
+    // Values with too many digits for the mantissa (the leading zeros do not count) keep only their first significant digits
+    decimal.truncated = false;
+    if (digits_count > MAX_MANTISSA_DIGITS)
+    {
+        const char* digit = decimal.digits;
+        while ((digit != decimal.end_of_digits) && ((*digit == '0') || (*digit == '.')))
+        {
+            digits_count -= ((*digit == '0') ? 1u : 0u);
+            digit++;
+        }
+        if (digits_count > MAX_MANTISSA_DIGITS)
+        {
+            mantissa = 0u;
+            for (size_t i = 0u; digit != decimal.end_of_digits; digit++)
+            {
+                if (*digit != '.')
+                {
+                    if (i < MAX_MANTISSA_DIGITS)
+                    {
+                        mantissa = mantissa * 10u + static_cast<uint64_t>(*digit - '0');
+                        i++;
+                    }
+                    else
+                    {
+                        decimal.truncated = (decimal.truncated || (*digit != '0'));
+                        exponent++;
+                    }
+                }
+            }
+        }
+    }
+    decimal.mantissa = mantissa;
+    decimal.exponent = exponent;
+
+    return (valid && (position == end));
+}
+
+/** @brief Convert a decimal value to the closest floating point value */
+template <typename FloatT>
+static FloatT decimal_to_float(const decimal_number& decimal)
+{
+    using format = binary_format<FloatT>;
+
+    const int64_t q   = decimal.exponent;
+    FloatT        val = 0;
+    if (!decimal.truncated && (FLT_EVAL_METHOD == 0) && (q >= -format::MAX_EXACT_POWER_OF_TEN) && (q <= format::MAX_EXACT_POWER_OF_TEN) &&
+        (decimal.mantissa <= (static_cast<uint64_t>(2u) << format::MANTISSA_BITS)))
+    {
+        // Clinger's fast path : the mantissa and the power of 10 are exact floating point values,
+        // so a single correctly rounded operation gives the result
+        val = static_cast<FloatT>(decimal.mantissa);
+        if (q < 0)
+        {
+            val = val / static_cast<FloatT>(EXACT_POWERS_OF_TEN[static_cast<size_t>(-q)]);
+        }
+        else
+        {
+            val = val * static_cast<FloatT>(EXACT_POWERS_OF_TEN[static_cast<size_t>(q)]);
+        }
+        val = (decimal.negative ? -val : val);
+    }
+    else
+    {
+        uint64_t mantissa = 0u;
+        int32_t  power2   = 0;
+        bool     success  = compute_float<FloatT>(decimal.mantissa, q, mantissa, power2);
+        if (success && decimal.truncated)
+        {
+            // The dropped digits must not change the rounding
+            uint64_t mantissa_up = 0u;
+            int32_t  power2_up   = 0;
+            success = (compute_float<FloatT>(decimal.mantissa + 1u, q, mantissa_up, power2_up) && (mantissa == mantissa_up) &&
+                       (power2 == power2_up));
+        }
+        if (success)
+        {
+            using bits_t      = typename format::bits_t;
+            const bits_t bits = static_cast<bits_t>(mantissa | (static_cast<uint64_t>(power2) << format::MANTISSA_BITS) |
+                                                    (static_cast<uint64_t>(decimal.negative) << (sizeof(FloatT) * 8u - 1u)));
+            memcpy(&val, &bits, sizeof(val));
+        }
+        else
+        {
+            val = slow_decimal_to_float<FloatT>(decimal);
+        }
+    }
+
+    return val;
+}
+
+/** @brief Compute the biased exponent and the mantissa of the floating point value closest to w * 10^q using the Eisel-Lemire algorithm,
+ *         returns false if the rounding can't be decided with the 64 bits approximation of the power of 10
+ */
+template <typename FloatT>
+static bool compute_float(uint64_t w, int64_t q, uint64_t& mantissa, int32_t& power2)
+{
+    using format = binary_format<FloatT>;
+
+    bool success = true;
+    mantissa     = 0u;
+    power2       = 0;
+    if ((w == 0u) || (q < format::MIN_POWER_OF_TEN))
+    {
+        // Zero
+    }
+    else if (q > format::MAX_POWER_OF_TEN)
+    {
+        // Infinity
+        power2 = format::INFINITE_POWER;
+    }
+    else
+    {
+        // Multiply the normalized mantissa by the truncated power of 5, the power of 2 is applied on the exponent
+        const int32_t power10 = static_cast<int32_t>(q);
+        const int32_t lz      = count_leading_zeros(w);
+        w <<= lz;
+        uint64_t       low  = 0u;
+        const uint64_t high = full_multiplication(w, POWERS_OF_FIVE[power10 - binary_format<double>::MIN_POWER_OF_TEN], low);
+
+        // The truncated bits of the power of 5 add less than w to the product : the result is exact unless
+        // it could propagate a carry up to the bits of the mantissa
+        constexpr uint64_t PRECISION_MASK = (UINT64_MAX >> (format::MANTISSA_BITS + 3));
+        if (((high & PRECISION_MASK) == PRECISION_MASK) && ((low + w) < low))
+        {
+            success = false;
+        }
+        else
+        {
+            // Keep 1 more bit than the mantissa for rounding
+            const int32_t upper_bit = static_cast<int32_t>(high >> 63u);
+            const int32_t shift     = upper_bit + 64 - format::MANTISSA_BITS - 3;
+            mantissa                = (high >> shift);
+            power2                  = ((((152170 + 65536) * power10) >> 16) + 63) + upper_bit - lz - format::MIN_EXPONENT;
+            if (power2 <= 0)
+            {
+                // Subnormal value
+                if ((-power2 + 1) >= 64)
+                {
+                    mantissa = 0u;
+                    power2   = 0;
+                }
+                else
+                {
+                    mantissa >>= (-power2 + 1);
+                    mantissa += (mantissa & 1u);
+                    mantissa >>= 1u;
+                    power2 = ((mantissa < (static_cast<uint64_t>(1u) << format::MANTISSA_BITS)) ? 0 : 1);
+                }
+            }
+            else
+            {
+                if ((low <= 1u) && (power10 >= format::MIN_ROUND_TO_EVEN) && (power10 <= format::MAX_ROUND_TO_EVEN) &&
+                    ((mantissa & 3u) == 1u) && ((mantissa << shift) == high))
+                {
+                    // Exactly halfway between 2 values : round to even, only the positive powers of 5 are exact
+                    // in the table so that the negative ones may hide a value slightly above halfway
+                    mantissa &= ~static_cast<uint64_t>(1u);
+                    success = (power10 >= 0);
+                }
+                mantissa += (mantissa & 1u);
+                mantissa >>= 1u;
+                if (mantissa >= (static_cast<uint64_t>(2u) << format::MANTISSA_BITS))
+                {
+                    // Rounding overflow
+                    mantissa = (static_cast<uint64_t>(1u) << format::MANTISSA_BITS);
+                    power2++;
+                }
+                mantissa &= ~(static_cast<uint64_t>(1u) << format::MANTISSA_BITS);
+                if (power2 >= format::INFINITE_POWER)
+                {
+                    mantissa = 0u;
+                    power2   = format::INFINITE_POWER;
+                }
+            }
+        }
+    }
+
+    return success;
+}
+
+/** @brief Convert the significant digits of a decimal value using the C library : slow but used only for the values
+ *         that the Eisel-Lemire algorithm can't round
+ */
+template <typename FloatT>
+static FloatT slow_decimal_to_float(const decimal_number& decimal)
+{
+    using format = binary_format<FloatT>;
+
+    // Build a "-DDDDeX" string with all the significant digits which can decide the rounding, the dropped digits
+    // being replaced by a single non zero digit so that the value stays above the truncated value
+    char   buffer[format::MAX_DECIMAL_DIGITS + 16u];
+    size_t size = 0u;
+    if (decimal.negative)
+    {
+        buffer[size] = '-';
+        size++;
+    }
+    const size_t start_of_digits = size;
+    size_t       digits_count    = 0u;
+    bool         truncated       = false;
+    for (const char* digit = decimal.digits; digit != decimal.end_of_digits; digit++)
+    {
+        if ((*digit == '.') || ((digits_count == 0u) && (*digit == '0')))
+        {
+            // Decimal point or leading zero
+        }
+        else if (digits_count < format::MAX_DECIMAL_DIGITS)
+        {
+            buffer[size] = *digit;
+            size++;
+            digits_count++;
+        }
+        else
+        {
+            truncated = (truncated || (*digit != '0'));
+        }
+    }
+    int64_t exponent = decimal.exponent;
+    if (digits_count > MAX_MANTISSA_DIGITS)
+    {
+        exponent -= static_cast<int64_t>(digits_count - MAX_MANTISSA_DIGITS);
+    }
+    if (truncated)
+    {
+        buffer[size] = '1';
+        size++;
+        exponent--;
+    }
+    if (size == start_of_digits)
+    {
+        buffer[size] = '0';
+        size++;
+    }
+    buffer[size] = 'e';
+    size++;
+    if (exponent < 0)
+    {
+        buffer[size] = '-';
+        size++;
+        exponent = -exponent;
+    }
+    exponent = ((exponent < 999999) ? exponent : 999999);
+    char   exponent_digits[8u];
+    size_t exponent_size = 0u;
+    do
+    {
+        exponent_digits[exponent_size] = static_cast<char>('0' + (exponent % 10));
+        exponent_size++;
+        exponent /= 10;
+    } while (exponent != 0);
+    while (exponent_size != 0u)
+    {
+        exponent_size--;
+        buffer[size] = exponent_digits[exponent_size];
+        size++;
+    }
+    buffer[size] = 0;
+
+    FloatT val = 0;
+    if constexpr (std::is_same_v<FloatT, float>)
+    {
+        val = strtof(buffer, nullptr);
+    }
+    else
+    {
+        val = strtod(buffer, nullptr);
+    }
+    return val;
+}
+
+/** @brief Multiply 2 64 bits integers, returns the upper 64 bits of the result and stores the lower 64 bits in low */
+static uint64_t full_multiplication(uint64_t a, uint64_t b, uint64_t& low)
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ using uint128_t = unsigned __int128;
+    const uint128_t product       = static_cast<uint128_t>(a) * b;
+    low                           = static_cast<uint64_t>(product);
+    return static_cast<uint64_t>(product >> 64u);
+#else
+    // Sum of the products of the 32 bits halves
+    const uint64_t a_low     = (a & 0xFFFFFFFFu);
+    const uint64_t a_high    = (a >> 32u);
+    const uint64_t b_low     = (b & 0xFFFFFFFFu);
+    const uint64_t b_high    = (b >> 32u);
+    const uint64_t low_low   = a_low * b_low;
+    const uint64_t high_low  = a_high * b_low;
+    const uint64_t low_high  = a_low * b_high;
+    const uint64_t high_high = a_high * b_high;
+    const uint64_t middle    = (low_low >> 32u) + (high_low & 0xFFFFFFFFu) + low_high;
+    low                      = ((middle << 32u) | (low_low & 0xFFFFFFFFu));
+    return (high_high + (high_low >> 32u) + (middle >> 32u));
+#endif
+}
+
+/** @brief Count the leading zero bits of a non zero 64 bits integer */
+static int32_t count_leading_zeros(uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<int32_t>(__builtin_clzll(value));
+#else
+    int32_t count = 0;
+    while ((value & (static_cast<uint64_t>(1u) << 63u)) == 0u)
+    {
+        value <<= 1u;
+        count++;
+    }
+    return count;
+#endif
+}
+
+#endif // NANOJSONCPP_USE_CPP17_FROM_CHARS_TO_CHARS
+
 } // namespace nanojsoncpp
@@ -7,6 +7,7 @@
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -69,14 +70,21 @@ int main(int argc, char* argv[])
 
             nanojsoncpp::json_size_t                  error_index = 0u;
             nanojsoncpp::json_parse_error             error       = nanojsoncpp::json_parse_error::no_error;
-            std::vector<nanojsoncpp::json_value_desc> descriptors(1000000);
-            auto                                      root = nanojsoncpp::parse(input_json_str,
-                                           descriptors,
-                                           [&](nanojsoncpp::json_size_t _error_index, nanojsoncpp::json_parse_error _error)
-                                           {
-                                               error_index = _error_index;
-                                               error       = _error;
-                                           });
+            std::vector<nanojsoncpp::json_value_desc> descriptors;
+            std::optional<nanojsoncpp::json_value>    root;
+            auto callback = [&](nanojsoncpp::json_size_t _error_index, nanojsoncpp::json_parse_error _error)
+            {
+                error_index = _error_index;
+                error       = _error;
+            };
+
+            // Allocate the exact number of descriptors needed
+            auto count = nanojsoncpp::parse_count(input_json_str, callback);
+            if (count)
+            {
+                descriptors.resize(count->descriptors);
+                root = nanojsoncpp::parse(input_json_str, descriptors, callback);
+            }
             if (root)
             {
                 // Open output file
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2025 c-jimenez
+ * SPDX-License-Identifier: MIT
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include <nanojsoncpp/nanojsoncpp.h>
+
+#include <string>
+#include <vector>
+
+// Check that a cursor and a parsed value have the same contents
+static void check_same_value(const nanojsoncpp::json_cursor& cursor, const nanojsoncpp::json_value& value);
+
+TEST_SUITE("json on-demand access test suite")
+{
+    TEST_CASE("Member and element access")
+    {
+        std::string json_input = R"({ "skipped": { "a": [1, {"b": "}]"}, [[]] ], "c": "\"{[" },
+                                      "null": null, "bool": true, "int": -123, "dec": 45.5e2,
+                                      "str": "a \"quoted\" string",
+                                      "array": [ 10, "twenty", [30], {"forty": 40} ],
+                                      "empty_obj": {}, "empty_array": [ ] })";
+
+        auto root = nanojsoncpp::parse_on_demand(json_input);
+        REQUIRE(root);
+        CHECK(root->is_object());
+        CHECK_EQ(root->size(), 9u);
+
+        auto null_value = root->get("null");
+        REQUIRE(null_value);
+        CHECK(null_value->is_null());
+        CHECK_EQ(null_value->name(), "null");
+        CHECK_EQ(null_value->get(), "null");
+
+        auto bool_value = (*root)["bool"];
+        REQUIRE(bool_value);
+        CHECK(bool_value->is_bool());
+        CHECK(bool_value->get<bool>());
+
+        auto int_value = root->get("int");
+        REQUIRE(int_value);
+        CHECK(int_value->is_integer());
+        CHECK(int_value->is_decimal());
+        CHECK_EQ(int_value->get<int>(), -123);
+
+        auto dec_value = root->get("dec");
+        REQUIRE(dec_value);
+        CHECK_FALSE(dec_value->is_integer());
+        CHECK(dec_value->is_decimal());
+        CHECK_EQ(dec_value->get(), "45.5e2");
+        CHECK_EQ(dec_value->get<nanojsoncpp::json_float_t>(), static_cast<nanojsoncpp::json_float_t>(4550.));
+
+        auto exp_root = nanojsoncpp::parse_on_demand("[2E-3]");
+        REQUIRE(exp_root);
+        CHECK_FALSE(exp_root->get(0u)->is_integer());
+        CHECK(exp_root->get(0u)->is_decimal());
+
+        auto str_value = root->get("str");
+        REQUIRE(str_value);
+        CHECK(str_value->is_string());
+        CHECK_EQ(str_value->get(), R"(a \"quoted\" string)");
+        CHECK_EQ(str_value->size(), 19u);
+
+        auto array_value = root->get("array");
+        REQUIRE(array_value);
+        CHECK(array_value->is_array());
+        CHECK_EQ(array_value->size(), 4u);
+        CHECK_EQ(array_value->get(0u)->get<int>(), 10);
+        CHECK_EQ((*array_value)[1u]->get(), "twenty");
+        CHECK_EQ(array_value->get(2u)->get(0u)->get<int>(), 30);
+        CHECK_EQ(array_value->get(3u)->get("forty")->get<int>(), 40);
+        CHECK_EQ(array_value->get(3u)->get("forty")->name(), "forty");
+        CHECK_FALSE(array_value->get(4u));
+        CHECK_FALSE(array_value->get("forty"));
+        CHECK_EQ(array_value->get(1u)->name(), "");
+
+        auto empty_obj = root->get("empty_obj");
+        REQUIRE(empty_obj);
+        CHECK(empty_obj->is_object());
+        CHECK_EQ(empty_obj->size(), 0u);
+        CHECK_EQ(empty_obj->get(), "{}");
+        CHECK_FALSE(empty_obj->get("a"));
+
+        auto empty_array = root->get("empty_array");
+        REQUIRE(empty_array);
+        CHECK(empty_array->is_array());
+        CHECK_EQ(empty_array->size(), 0u);
+        CHECK_EQ(empty_array->get(), "[ ]");
+        CHECK_FALSE(empty_array->get(0u));
+
+        // Nested values containing brackets in strings
+        auto skipped = root->get("skipped");
+        REQUIRE(skipped);
+        CHECK_EQ(skipped->get(), R"({ "a": [1, {"b": "}]"}, [[]] ], "c": "\"{[" })");
+        CHECK_EQ(skipped->get("a")->get(1u)->get("b")->get(), "}]");
+        CHECK_EQ(skipped->get("c")->get(), R"(\"{[)");
+
+        CHECK_FALSE(root->get("unknown"));
+        CHECK_FALSE(root->get(0u));
+
+        std::vector<std::string_view> names;
+        for (const auto& member : root.value())
+        {
+            names.push_back(member.name());
+        }
+        CHECK_EQ(names, std::vector<std::string_view>{"skipped", "null", "bool", "int", "dec", "str", "array", "empty_obj", "empty_array"});
+
+        auto root_array = nanojsoncpp::parse_on_demand("  [ true, false ] ");
+        REQUIRE(root_array);
+        CHECK(root_array->is_array());
+        CHECK_EQ(root_array->size(), 2u);
+        CHECK_FALSE(root_array->get(1u)->get<bool>());
+    }
+
+    TEST_CASE("Same values as parse")
+    {
+        std::string json_input = R"({
+            "name": "device", "id": 1234, "ratio": 0.75, "enabled": false, "owner": null,
+            "sensors": [ { "type": "temp", "values": [ 21.5, 22, -3.25 ] }, { "type": "hum", "values": [] } ],
+            "tags": [ "a", "b\\c", "d\"e" ], "nested": [ [ [ 1 ], { "x": { "y": "z" } } ] ]
+        })";
+
+        std::array<nanojsoncpp::json_value_desc, 50u> descriptors;
+        auto                                          parsed = nanojsoncpp::parse(json_input, descriptors);
+        REQUIRE(parsed);
+        auto cursor = nanojsoncpp::parse_on_demand(json_input);
+        REQUIRE(cursor);
+
+        check_same_value(cursor.value(), parsed.value());
+    }
+
+    TEST_CASE("Skipping long nested values")
+    {
+        // Move the escaped chars and the brackets across the boundaries of the blocks of chars classified at once
+        for (size_t padding = 0u; padding < 140u; padding++)
+        {
+            std::string json_input = R"({ "skipped": [ ")" + std::string(padding, 'x') + R"(\\", "\"]\\\"}", { "a": ["\\\\\\"] }, )" +
+                                     std::string(padding, ' ') + R"(["]]]\"}}}" ] ], "last": "\\)" + std::string(padding % 3u, '\\') +
+                                     std::string(padding % 3u, '\\') + R"(" })";
+
+            std::array<nanojsoncpp::json_value_desc, 20u> descriptors;
+            auto                                          parsed = nanojsoncpp::parse(json_input, descriptors);
+            REQUIRE(parsed);
+            auto cursor = nanojsoncpp::parse_on_demand(json_input);
+            REQUIRE(cursor);
+
+            check_same_value(cursor.value(), parsed.value());
+            REQUIRE(cursor->get("last"));
+            CHECK_EQ(cursor->get("last")->get(), parsed->get("last")->get());
+        }
+    }
+
+    TEST_CASE("Malformed json strings")
+    {
+        CHECK_FALSE(nanojsoncpp::parse_on_demand(""));
+        CHECK_FALSE(nanojsoncpp::parse_on_demand("   "));
+        CHECK_FALSE(nanojsoncpp::parse_on_demand("\"string\""));
+        CHECK_FALSE(nanojsoncpp::parse_on_demand("12"));
+
+        // Unterminated object : accessible members are still available
+        auto root1 = nanojsoncpp::parse_on_demand(R"({ "a": 1, "b": [2, 3)");
+        REQUIRE(root1);
+        CHECK_EQ(root1->get("a")->get<int>(), 1);
+        auto b = root1->get("b");
+        REQUIRE(b);
+        CHECK_EQ(b->get(), "");
+        CHECK_EQ(b->get(1u)->get<int>(), 3);
+        CHECK_FALSE(root1->get("c"));
+        CHECK_EQ(root1->get(), "");
+
+        // Unterminated string
+        auto root2 = nanojsoncpp::parse_on_demand(R"({ "a": "abc)");
+        REQUIRE(root2);
+        CHECK_EQ(root2->get("a")->get(), "");
+        CHECK_EQ(root2->size(), 1u);
+
+        auto root3 = nanojsoncpp::parse_on_demand(R"({ "a": "ab\")");
+        REQUIRE(root3);
+        CHECK_EQ(root3->get("a")->get(), "");
+
+        // Invalid member names and values
+        auto root4 = nanojsoncpp::parse_on_demand(R"({ a: 1 })");
+        REQUIRE(root4);
+        CHECK_EQ(root4->size(), 0u);
+        CHECK_FALSE(root4->get("a"));
+
+        auto root5 = nanojsoncpp::parse_on_demand(R"({ "a" 1, "b": 2 })");
+        REQUIRE(root5);
+        CHECK_FALSE(root5->get("b"));
+
+        auto root6 = nanojsoncpp::parse_on_demand(R"([ 1, :, 3 ])");
+        REQUIRE(root6);
+        CHECK_EQ(root6->size(), 1u);
+        CHECK_FALSE(root6->get(2u));
+
+        auto root7 = nanojsoncpp::parse_on_demand(R"({ "a": 1 "b": 2 })");
+        REQUIRE(root7);
+        CHECK_EQ(root7->size(), 1u);
+        CHECK_FALSE(root7->get("b"));
+    }
+}
+
+// Check that a cursor and a parsed value have the same contents
+static void check_same_value(const nanojsoncpp::json_cursor& cursor, const nanojsoncpp::json_value& value)
+{
+    CHECK_EQ(cursor.type(), value.type());
+    CHECK_EQ(cursor.name(), value.name());
+    CHECK_EQ(cursor.size(), value.size());
+    if (value.is_object() || value.is_array())
+    {
+        auto cursor_it = cursor.begin();
+        for (const auto& child : value)
+        {
+            REQUIRE(cursor_it != cursor.end());
+            check_same_value(*cursor_it, child);
+            ++cursor_it;
+        }
+        CHECK_FALSE(cursor_it != cursor.end());
+    }
+    else
+    {
+        CHECK_EQ(cursor.get(), value.get());
+    }
+}
@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2025 c-jimenez
+ * SPDX-License-Identifier: MIT
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include <nanojsoncpp/nanojsoncpp_parallel.h>
+
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Build a newline delimited json string
+static std::string build_records(size_t count);
+
+// Build a big json string
+static std::string build_document(bool object, size_t count);
+
+// Check that the values of a parallel parsing are the same as the values of a serial parsing
+static void check_same_descriptors(const std::vector<nanojsoncpp::json_value_desc>& descriptors,
+                                   const std::vector<nanojsoncpp::json_value_desc>& expected_descriptors);
+
+// Marker of the descriptors which have not been written
+static constexpr uint8_t UNUSED_DESCRIPTOR = 0xEEu;
+
+TEST_SUITE("json parallel parsing test suite")
+{
+    TEST_CASE("Documents parsing")
+    {
+        const std::string json_input = build_records(1000u);
+
+        for (size_t threads_count = 1u; threads_count <= 5u; threads_count++)
+        {
+            std::vector<nanojsoncpp::json_value_desc> descriptors(threads_count * 10u);
+            std::mutex                                mutex;
+            std::vector<size_t>                       ids;
+            std::vector<size_t>                       offsets;
+            bool                                      valid_thread_indexes = true;
+            bool                                      success              = nanojsoncpp::parse_many_parallel(
+                json_input,
+                descriptors,
+                threads_count,
+                [&](size_t thread_index, const nanojsoncpp::json_document& document)
+                {
+                    const size_t id = document.root.get("id")->get<size_t>();
+                    CHECK_EQ(json_input.substr(document.offset, document.size),
+                             "{\"id\": " + std::to_string(id) + ", \"values\": [" + std::to_string(id % 7u) + ", true]}");
+                    std::lock_guard<std::mutex> lock(mutex);
+                    valid_thread_indexes = valid_thread_indexes && (thread_index < threads_count);
+                    ids.push_back(id);
+                    offsets.push_back(document.offset);
+                });
+            CHECK(success);
+            CHECK(valid_thread_indexes);
+
+            // The offsets allow to restore the input order
+            REQUIRE_EQ(ids.size(), 1000u);
+            std::vector<size_t> order(ids.size());
+            for (size_t i = 0u; i < order.size(); i++)
+            {
+                order[i] = i;
+            }
+            std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return offsets[a] < offsets[b]; });
+            for (size_t i = 0u; i < order.size(); i++)
+            {
+                CHECK_EQ(ids[order[i]], i);
+            }
+        }
+
+        // Default number of threads
+        size_t count   = 0u;
+        auto   handler = [&](size_t, const nanojsoncpp::json_document&)
+        {
+            static std::mutex           mutex;
+            std::lock_guard<std::mutex> lock(mutex);
+            count++;
+        };
+        std::vector<nanojsoncpp::json_value_desc> descriptors(1000u);
+        CHECK(nanojsoncpp::parse_many_parallel(json_input, descriptors, 0u, handler));
+        CHECK_EQ(count, 1000u);
+
+        // Less documents than chunks
+        count = 0u;
+        CHECK(nanojsoncpp::parse_many_parallel(build_records(3u), descriptors, 4u, handler));
+        CHECK_EQ(count, 3u);
+        count = 0u;
+        CHECK(nanojsoncpp::parse_many_parallel("", descriptors, 4u, handler));
+        CHECK(nanojsoncpp::parse_many_parallel("\n\n\n", descriptors, 4u, handler));
+        CHECK_EQ(count, 0u);
+    }
+
+    TEST_CASE("Invalid documents")
+    {
+        std::string json_input = build_records(500u);
+        json_input += "{\"id\": 500, \"values\": [1, tru]}\n";
+        json_input += build_records(500u);
+
+        for (size_t threads_count = 1u; threads_count <= 4u; threads_count++)
+        {
+            std::vector<nanojsoncpp::json_value_desc> descriptors(threads_count * 10u);
+            size_t                                    errors_count = 0u;
+            size_t                                    error_offset = 0u;
+            nanojsoncpp::json_size_t                  error_index  = 0u;
+            nanojsoncpp::json_parse_error             error        = nanojsoncpp::json_parse_error::no_error;
+            CHECK_FALSE(nanojsoncpp::parse_many_parallel(
+                json_input,
+                descriptors,
+                threads_count,
+                [](size_t, const nanojsoncpp::json_document&) {},
+                [&](size_t _error_offset, nanojsoncpp::json_size_t _error_index, nanojsoncpp::json_parse_error _error)
+                {
+                    errors_count++;
+                    error_offset = _error_offset;
+                    error_index  = _error_index;
+                    error        = _error;
+                }));
+            CHECK_EQ(errors_count, 1u);
+            CHECK_EQ(error_offset, json_input.find("{\"id\": 500"));
+            CHECK_EQ(error_index, 26u);
+            CHECK_EQ(error, nanojsoncpp::json_parse_error::invalid_value);
+        }
+
+        // Not enough descriptors for each thread
+        std::vector<nanojsoncpp::json_value_desc> descriptors(10u);
+        nanojsoncpp::json_parse_error             error = nanojsoncpp::json_parse_error::no_error;
+        CHECK_FALSE(nanojsoncpp::parse_many_parallel(build_records(100u),
+                                                     descriptors,
+                                                     2u,
+                                                     [](size_t, const nanojsoncpp::json_document&) {},
+                                                     [&](size_t, nanojsoncpp::json_size_t, nanojsoncpp::json_parse_error _error)
+                                                     { error = _error; }));
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::not_enough_memory);
+    }
+
+    TEST_CASE("Single document parsing")
+    {
+        for (bool object : {false, true})
+        {
+            const std::string json_input = build_document(object, 330u);
+            REQUIRE_LT(json_input.size(), nanojsoncpp::MAX_JSON_STRING_SIZE);
+            REQUIRE_GT(json_input.size(), 3u * nanojsoncpp::PARALLEL_MIN_PART_SIZE);
+
+            std::vector<nanojsoncpp::json_value_desc> expected_descriptors(20000u);
+            auto                                      expected_root = nanojsoncpp::parse(json_input, expected_descriptors);
+            REQUIRE(expected_root);
+
+            for (size_t threads_count = 1u; threads_count <= 4u; threads_count++)
+            {
+                // The descriptors written by the threads after the end marker show that the json string has been split
+                std::vector<nanojsoncpp::json_value_desc> descriptors(20000u);
+                for (auto& desc : descriptors)
+                {
+                    desc.nesting_level = UNUSED_DESCRIPTOR;
+                }
+                auto root = nanojsoncpp::parse_parallel(json_input, descriptors, threads_count);
+                REQUIRE(root);
+                CHECK_EQ(root->size(), 330u);
+                check_same_descriptors(descriptors, expected_descriptors);
+                CHECK_EQ((object ? root->get("member_329") : root->get(329u))->get("id")->get<int>(), 329);
+                const bool split = std::any_of(descriptors.begin() + static_cast<std::ptrdiff_t>(expected_root->size() * 20u),
+                                               descriptors.end(),
+                                               [](const auto& desc) { return (desc.nesting_level != UNUSED_DESCRIPTOR); });
+                CHECK_EQ(split, (threads_count > 1u));
+            }
+        }
+
+        // Move the escaped chars and the strings across the boundaries of the chunks
+        for (size_t padding = 0u; padding < 70u; padding++)
+        {
+            const std::string json_input = "[\"" + std::string(padding, '\\') + std::string(padding, '\\') + "\", " +
+                                           build_document(false, 320u).substr(1u, std::string::npos);
+
+            std::vector<nanojsoncpp::json_value_desc> expected_descriptors(20000u);
+            REQUIRE(nanojsoncpp::parse(json_input, expected_descriptors));
+            std::vector<nanojsoncpp::json_value_desc> descriptors(20000u);
+            REQUIRE(nanojsoncpp::parse_parallel(json_input, descriptors, 3u));
+            check_same_descriptors(descriptors, expected_descriptors);
+        }
+    }
+
+    TEST_CASE("Single document errors")
+    {
+        const std::string valid_input   = build_document(false, 330u);
+        const size_t      element_start = valid_input.find(", {", 30000u) + 2u;
+
+        // Same errors as a serial parsing
+        for (const auto& json_input : {valid_input.substr(0u, valid_input.size() - 1u),
+                                       valid_input + " x",
+                                       "{" + valid_input.substr(1u, std::string::npos),
+                                       valid_input.substr(0u, element_start) + "}" + valid_input.substr(element_start, std::string::npos),
+                                       valid_input.substr(0u, element_start) + "\"" + valid_input.substr(element_start, std::string::npos),
+                                       std::string(3u * nanojsoncpp::PARALLEL_MIN_PART_SIZE, ' ')})
+        {
+            std::vector<nanojsoncpp::json_value_desc> descriptors(20000u);
+            nanojsoncpp::json_size_t                  expected_index = 0u;
+            nanojsoncpp::json_parse_error             expected_error = nanojsoncpp::json_parse_error::no_error;
+            CHECK_FALSE(nanojsoncpp::parse(json_input,
+                                           descriptors,
+                                           [&](nanojsoncpp::json_size_t index, nanojsoncpp::json_parse_error error)
+                                           {
+                                               expected_index = index;
+                                               expected_error = error;
+                                           }));
+
+            nanojsoncpp::json_size_t      error_index = 0u;
+            nanojsoncpp::json_parse_error error       = nanojsoncpp::json_parse_error::no_error;
+            CHECK_FALSE(nanojsoncpp::parse_parallel(json_input,
+                                                    descriptors,
+                                                    3u,
+                                                    [&](nanojsoncpp::json_size_t index, nanojsoncpp::json_parse_error _error)
+                                                    {
+                                                        error_index = index;
+                                                        error       = _error;
+                                                    }));
+            CHECK_EQ(error_index, expected_index);
+            CHECK_EQ(error, expected_error);
+        }
+
+        // Not enough descriptors for the parts of the threads : serial parsing
+        auto count = nanojsoncpp::parse_count(valid_input);
+        REQUIRE(count);
+        std::vector<nanojsoncpp::json_value_desc> descriptors(count->descriptors);
+        std::vector<nanojsoncpp::json_value_desc> expected_descriptors(count->descriptors);
+        REQUIRE(nanojsoncpp::parse(valid_input, expected_descriptors));
+        REQUIRE(nanojsoncpp::parse_parallel(valid_input, descriptors, 3u));
+        check_same_descriptors(descriptors, expected_descriptors);
+        descriptors.resize(count->descriptors - 1u);
+        CHECK_FALSE(nanojsoncpp::parse_parallel(valid_input, descriptors, 3u));
+    }
+}
+
+// Build a big json string
+static std::string build_document(bool object, size_t count)
+{
+    std::string document = (object ? "{" : "[");
+    for (size_t i = 0u; i < count; i++)
+    {
+        if (i != 0u)
+        {
+            document += ", ";
+        }
+        if (object)
+        {
+            document += "\"member_" + std::to_string(i) + "\": ";
+        }
+        document += "{ \"id\": " + std::to_string(i) + ", \"name\": \"item \\\"" + std::to_string(i) + "\\\" [a, b], {c, d}\"" +
+                    ", \"path\": \"" + std::string(i % 4u, 'x') + "\\\\dir\\\\\", \"values\": [" + std::to_string(i % 10u) +
+                    ", -12.5, true, null, [[]], {}], \"nested\": { \"a\": [\"]\", \",\"], \"b\": { \"c\": false } } }";
+    }
+    document += (object ? "}" : "]");
+    return document;
+}
+
+// Check that the values of a parallel parsing are the same as the values of a serial parsing
+static void check_same_descriptors(const std::vector<nanojsoncpp::json_value_desc>& descriptors,
+                                   const std::vector<nanojsoncpp::json_value_desc>& expected_descriptors)
+{
+    size_t i = 0u;
+    do
+    {
+        const auto& desc     = descriptors[i];
+        const auto& expected = expected_descriptors[i];
+        CHECK_EQ(desc.nesting_level, expected.nesting_level);
+        CHECK_EQ(desc.name_start, expected.name_start);
+        CHECK_EQ(desc.name_size, expected.name_size);
+        CHECK_EQ(desc.value_start, expected.value_start);
+        CHECK_EQ(desc.value_size, expected.value_size);
+#ifdef NANOJSONCPP_USE_SUBTREE_SIZE
+        CHECK_EQ(desc.subtree_size, expected.subtree_size);
+#endif // NANOJSONCPP_USE_SUBTREE_SIZE
+        if ((i == 0u) || (expected.nesting_level != 0u))
+        {
+            CHECK_EQ(desc.type, expected.type);
+#ifdef NANOJSONCPP_USE_NAME_HASH
+            if (expected.name_size != 0u)
+            {
+                CHECK_EQ(desc.name_hash, expected.name_hash);
+            }
+#endif // NANOJSONCPP_USE_NAME_HASH
+#ifdef NANOJSONCPP_USE_UTF8_VALIDATION
+            if (expected.type == nanojsoncpp::json_value_type::string)
+            {
+                CHECK_EQ(desc.ascii, expected.ascii);
+            }
+#endif // NANOJSONCPP_USE_UTF8_VALIDATION
+        }
+        i++;
+    } while ((i == 1u) || (expected_descriptors[i - 1u].nesting_level != 0u));
+}
+
+// Build a newline delimited json string
+static std::string build_records(size_t count)
+{
+    std::string records;
+    for (size_t i = 0u; i < count; i++)
+    {
+        records += "{\"id\": " + std::to_string(i) + ", \"values\": [" + std::to_string(i % 7u) + ", true]}\n";
+    }
+    return records;
+}
@@ -8,6 +8,12 @@
 
 #include <nanojsoncpp/nanojsoncpp.h>
 
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <vector>
+
 // Compute the total nesting levels of a json object or array tree
 static int compute_nesting_level(const nanojsoncpp::json_value& value, int current_level);
 
@@ -289,6 +295,76 @@ TEST_SUITE("json parsing test suite")
         CHECK_EQ(error, nanojsoncpp::json_parse_error::missing_end_of_string);
     }
 
+    TEST_CASE("Unicode escaped chars")
+    {
+        std::array<nanojsoncpp::json_value_desc, 8u> descriptors;
+        nanojsoncpp::json_size_t                     error_index = 0u;
+        nanojsoncpp::json_parse_error                error       = nanojsoncpp::json_parse_error::no_error;
+        char                                         buffer[64u];
+
+        auto on_error = [&](nanojsoncpp::json_size_t _error_index, nanojsoncpp::json_parse_error _error)
+        {
+            error_index = _error_index;
+            error       = _error;
+        };
+
+        // 1 to 4 bytes UTF-8 sequences, surrogate pairs in both cases
+        std::string json_input = R"(["\u0041\u00e9\u20AC\uD83D\uDE00", "x\ud83d\ude00y\n\u0000z", "caf\u00E9 \"au lait\"", "A\u007F", "plain"])";
+        auto        root       = nanojsoncpp::parse(json_input, descriptors, on_error);
+        REQUIRE(root);
+        CHECK_EQ(root->get(0u)->get_escaped(buffer), "A\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80");
+        CHECK_EQ(root->get(1u)->get_escaped(buffer), std::string_view("x\xF0\x9F\x98\x80y\n\0z", 9u));
+        CHECK_EQ(root->get(2u)->get_escaped(buffer), "caf\xC3\xA9 \"au lait\"");
+        CHECK_EQ(root->get(3u)->get_escaped(buffer), "A\x7F");
+        CHECK_EQ(root->get(4u)->get_escaped(buffer), "plain");
+
+        // The escaped chars give non ASCII chars
+        CHECK_FALSE(root->get(0u)->is_ascii());
+        CHECK_FALSE(root->get(1u)->is_ascii());
+        CHECK_FALSE(root->get(2u)->is_ascii());
+        CHECK(root->get(3u)->is_ascii());
+        CHECK(root->get(4u)->is_ascii());
+
+        // In-situ conversion
+        CHECK_EQ(root->get(1u)->get_escaped(), std::string_view("x\xF0\x9F\x98\x80y\n\0z", 9u));
+        CHECK_EQ(root->get(2u)->get_escaped(), "caf\xC3\xA9 \"au lait\"");
+
+        // Invalid escaped chars are reported at their backslash
+        const std::vector<std::pair<std::string, nanojsoncpp::json_size_t>> invalid_inputs = {{R"(["\u12G4"])", 2u},
+                                                                                              {R"(["ab\u12"])", 4u},
+                                                                                              {R"(["\U0041"])", 2u},
+                                                                                              {R"(["\uD83D"])", 2u},
+                                                                                              {R"(["\uD83Dx"])", 2u},
+                                                                                              {R"(["\uD83D\n"])", 2u},
+                                                                                              {R"(["\uD83DA"])", 2u},
+                                                                                              {R"(["\uDE00\uD83D"])", 2u}};
+        for (const auto& [invalid_input, expected_index] : invalid_inputs)
+        {
+            CHECK_FALSE(nanojsoncpp::parse(invalid_input, descriptors, on_error));
+            CHECK_EQ(error_index, expected_index);
+            CHECK_EQ(error, nanojsoncpp::json_parse_error::invalid_escaped_char);
+        }
+        CHECK_FALSE(nanojsoncpp::parse(R"(["\uD83D\uDE)", descriptors, on_error));
+        CHECK_EQ(error_index, 2u);
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::missing_end_of_string);
+
+        // Escaped chars split between the chunks of a stream
+        std::array<char, 64u> stream_buffer;
+        const std::string     stream_input = R"({"a": "\uD83D\uDE00", "b": "\u00e9\t"})";
+        for (size_t chunk_size = 1u; chunk_size <= stream_input.size(); chunk_size++)
+        {
+            nanojsoncpp::json_stream_parser parser(stream_buffer, descriptors);
+            for (size_t i = 0u; i < stream_input.size(); i += chunk_size)
+            {
+                REQUIRE(parser.feed(std::string_view(stream_input).substr(i, chunk_size)));
+            }
+            auto stream_root = parser.finish();
+            REQUIRE(stream_root);
+            CHECK_EQ(stream_root->get("a")->get_escaped(buffer), "\xF0\x9F\x98\x80");
+            CHECK_EQ(stream_root->get("b")->get_escaped(buffer), "\xC3\xA9\t");
+        }
+    }
+
     TEST_CASE("Integer value")
     {
         std::array<nanojsoncpp::json_value_desc, 5u> descriptors;
@@ -510,6 +586,61 @@ TEST_SUITE("json parsing test suite")
         CHECK_FALSE(root9);
         CHECK_EQ(error_index, 25u);
         CHECK_EQ(error, nanojsoncpp::json_parse_error::unexpected_char);
+
+        std::string json_input_obj10("{ \"test_dec10\": 12\0 }", 21u);
+
+        error_index = 0u;
+        error       = nanojsoncpp::json_parse_error::no_error;
+        auto root10 = nanojsoncpp::parse(json_input_obj10,
+                                         descriptors,
+                                         [&](nanojsoncpp::json_size_t _error_index, nanojsoncpp::json_parse_error _error)
+                                         {
+                                             error_index = _error_index;
+                                             error       = _error;
+                                         });
+        CHECK_FALSE(root10);
+        CHECK_EQ(error_index, 19u);
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::unexpected_char);
+    }
+
+    TEST_CASE("Exponent value")
+    {
+        std::array<nanojsoncpp::json_value_desc, 10u> descriptors;
+        nanojsoncpp::json_size_t                      error_index = 0u;
+        nanojsoncpp::json_parse_error                 error       = nanojsoncpp::json_parse_error::no_error;
+
+        std::string json_input = R"([1e5, -2.5E-3, 6.02e+23, 0e0, 12E2])";
+
+        auto root = nanojsoncpp::parse(json_input, descriptors);
+        REQUIRE(root);
+        for (const auto& value : root.value())
+        {
+            CHECK_EQ(value.type(), nanojsoncpp::json_value_type::decimal);
+        }
+        CHECK_EQ(root->get(0u)->get(), "1e5");
+        CHECK_EQ(root->get(0u)->get<nanojsoncpp::json_float_t>(), static_cast<nanojsoncpp::json_float_t>(1e5));
+        CHECK_EQ(root->get(1u)->get(), "-2.5E-3");
+        CHECK_EQ(root->get(1u)->get<nanojsoncpp::json_float_t>(), static_cast<nanojsoncpp::json_float_t>(-2.5e-3));
+        CHECK_EQ(root->get(2u)->get(), "6.02e+23");
+        CHECK_EQ(root->get(2u)->get<nanojsoncpp::json_float_t>(), static_cast<nanojsoncpp::json_float_t>(6.02e23));
+        CHECK_EQ(root->get(3u)->get<nanojsoncpp::json_float_t>(), static_cast<nanojsoncpp::json_float_t>(0.));
+        CHECK_EQ(root->get(4u)->get<nanojsoncpp::json_float_t>(), static_cast<nanojsoncpp::json_float_t>(1200.));
+
+        const char* invalid_inputs[] = {"[1e]", "[1e+]", "[-e5]", "[1e5e2]", "[1e5.2]", "[1e-+2]", "[1+2]", "[1.5-e2]"};
+        for (const char* invalid_input : invalid_inputs)
+        {
+            error_index = 0u;
+            error       = nanojsoncpp::json_parse_error::no_error;
+            CHECK_FALSE(nanojsoncpp::parse(invalid_input,
+                                           descriptors,
+                                           [&](nanojsoncpp::json_size_t _error_index, nanojsoncpp::json_parse_error _error)
+                                           {
+                                               error_index = _error_index;
+                                               error       = _error;
+                                           }));
+            CHECK_EQ(error_index, 1u);
+            CHECK_EQ(error, nanojsoncpp::json_parse_error::invalid_value);
+        }
     }
 
     TEST_CASE("Object value")
@@ -1259,22 +1390,74 @@ TEST_SUITE("json parsing test suite")
             CHECK_EQ(bool2->get<bool>(), false);
         }
 
+        SUBCASE("Empty nested values with blanks")
+        {
+            std::string json_input_obj1 = R"([[   ], {	}, [ [ ] ], 1])";
+
+            auto root1 = nanojsoncpp::parse(json_input_obj1, descriptors);
+            REQUIRE(root1);
+            CHECK_EQ(root1->size(), 4u);
+
+            auto array1 = root1->get(0u);
+            REQUIRE(array1);
+            CHECK_EQ(array1->type(), nanojsoncpp::json_value_type::array);
+            CHECK_EQ(array1->size(), 0u);
+
+            auto object1 = root1->get(1u);
+            REQUIRE(object1);
+            CHECK_EQ(object1->type(), nanojsoncpp::json_value_type::object);
+            CHECK_EQ(object1->size(), 0u);
+
+            auto array2 = root1->get(2u);
+            REQUIRE(array2);
+            CHECK_EQ(array2->type(), nanojsoncpp::json_value_type::array);
+            CHECK_EQ(array2->size(), 1u);
+
+            auto int1 = root1->get(3u);
+            REQUIRE(int1);
+            CHECK_EQ(int1->type(), nanojsoncpp::json_value_type::integer);
+            CHECK_EQ(int1->get<int>(), 1);
+        }
+
         SUBCASE("Nesting errors")
         {
             nanojsoncpp::json_size_t      error_index = 0u;
             nanojsoncpp::json_parse_error error       = nanojsoncpp::json_parse_error::no_error;
 
-            std::string json_input_obj_255 =
-                R"({"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_end":"really?"}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}})";
+            // Build nested objects/arrays around the configured maximum nesting level
+            auto nested_objects = [](size_t nesting_level)
+            {
+                std::string json_string;
+                for (size_t i = 1u; i < nesting_level; i++)
+                {
+                    json_string += R"({"test_nesting":234,"test_nesting_next":)";
+                }
+                json_string += R"({"test_nesting":234,"test_nesting_end":"really?"})";
+                json_string += std::string(nesting_level - 1u, '}');
+                return json_string;
+            };
+            auto nested_arrays = [](size_t nesting_level)
+            {
+                std::string json_string;
+                for (size_t i = 1u; i < nesting_level; i++)
+                {
+                    json_string += "[234,";
+                }
+                json_string += R"([234,"really?"])";
+                json_string += std::string(nesting_level - 1u, ']');
+                return json_string;
+            };
+            const size_t max_level = nanojsoncpp::MAX_NESTING_LEVEL;
+
+            std::string json_input_obj_max = nested_objects(max_level);
 
-            auto root1 = nanojsoncpp::parse(json_input_obj_255, descriptors);
+            auto root1 = nanojsoncpp::parse(json_input_obj_max, descriptors);
             REQUIRE(root1);
-            CHECK_EQ(compute_nesting_level(root1.value(), 1), 255);
+            CHECK_EQ(compute_nesting_level(root1.value(), 1), static_cast<int>(max_level));
 
-            std::string json_input_obj_256 =
-                R"({"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_next":{"test_nesting":234,"test_nesting_end":"really?"}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}})";
+            std::string json_input_obj_over = nested_objects(max_level + 1u);
 
-            auto root2 = nanojsoncpp::parse(json_input_obj_256,
+            auto root2 = nanojsoncpp::parse(json_input_obj_over,
                                             descriptors,
                                             [&](nanojsoncpp::json_size_t _error_index, nanojsoncpp::json_parse_error _error)
                                             {
@@ -1282,20 +1465,18 @@ TEST_SUITE("json parsing test suite")
                                                 error       = _error;
                                             });
             CHECK_FALSE(root2);
-            CHECK_EQ(error_index, 10200u);
+            CHECK_EQ(error_index, max_level * 40u);
             CHECK_EQ(error, nanojsoncpp::json_parse_error::max_nesting_level);
 
-            std::string json_input_arr_255 =
-                R"([234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,"really?"]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]])";
+            std::string json_input_arr_max = nested_arrays(max_level);
 
-            auto root3 = nanojsoncpp::parse(json_input_arr_255, descriptors);
+            auto root3 = nanojsoncpp::parse(json_input_arr_max, descriptors);
             REQUIRE(root3);
-            CHECK_EQ(compute_nesting_level(root3.value(), 1), 255);
+            CHECK_EQ(compute_nesting_level(root3.value(), 1), static_cast<int>(max_level));
 
-            std::string json_input_arr_256 =
-                R"([234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,[234,"really?"]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]])";
+            std::string json_input_arr_over = nested_arrays(max_level + 1u);
 
-            auto root4 = nanojsoncpp::parse(json_input_arr_256,
+            auto root4 = nanojsoncpp::parse(json_input_arr_over,
                                             descriptors,
                                             [&](nanojsoncpp::json_size_t _error_index, nanojsoncpp::json_parse_error _error)
                                             {
@@ -1303,11 +1484,1338 @@ TEST_SUITE("json parsing test suite")
                                                 error       = _error;
                                             });
             CHECK_FALSE(root4);
-            CHECK_EQ(error_index, 1275u);
+            CHECK_EQ(error_index, max_level * 5u);
             CHECK_EQ(error, nanojsoncpp::json_parse_error::max_nesting_level);
         }
     }
 
+    TEST_CASE("Long values")
+    {
+        std::array<nanojsoncpp::json_value_desc, 10u> descriptors;
+        nanojsoncpp::json_size_t                      error_index = 0u;
+        nanojsoncpp::json_parse_error                 error       = nanojsoncpp::json_parse_error::no_error;
+
+        // Values and blanks spanning over several blocks of 64 bytes
+        std::string long_string = "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore";
+        std::string long_escaped_string =
+            R"(Lorem ipsum dolor sit amet, \"consectetur\" adipiscing elit,\\ sed do eiusmod tempor incididunt ut labore\n)";
+        std::string long_blanks(150u, ' ');
+        std::string json_input_obj1 = "{" + long_blanks + "\"test_long_string\"" + long_blanks + ":" + long_blanks + "\"" + long_string +
+                                      "\"" + long_blanks + ",\t\r\n\"test_long_escaped_string\": \"" + long_escaped_string + "\"," +
+                                      long_blanks + "\"test_array\": [" + long_blanks + "1" + long_blanks + "]" + long_blanks + "}" + long_blanks;
+
+        auto root1 = nanojsoncpp::parse(json_input_obj1, descriptors);
+        REQUIRE(root1);
+        CHECK_EQ(root1->size(), 3u);
+
+        auto string1 = root1->get("test_long_string");
+        REQUIRE(string1);
+        CHECK_EQ(string1->type(), nanojsoncpp::json_value_type::string);
+        CHECK_EQ(string1->get(), long_string);
+
+        auto string2 = root1->get("test_long_escaped_string");
+        REQUIRE(string2);
+        CHECK_EQ(string2->type(), nanojsoncpp::json_value_type::string);
+        CHECK_EQ(string2->get(), long_escaped_string);
+
+        auto array1 = root1->get("test_array");
+        REQUIRE(array1);
+        CHECK_EQ(array1->type(), nanojsoncpp::json_value_type::array);
+        CHECK_EQ(array1->size(), 1u);
+
+        // Missing end of a long string
+        std::string json_input_obj2 = "{" + long_blanks + "\"test_long_string\": \"" + long_escaped_string + long_string;
+
+        auto root2 = nanojsoncpp::parse(json_input_obj2,
+                                        descriptors,
+                                        [&](nanojsoncpp::json_size_t _error_index, nanojsoncpp::json_parse_error _error)
+                                        {
+                                            error_index = _error_index;
+                                            error       = _error;
+                                        });
+        CHECK_FALSE(root2);
+        CHECK_EQ(error_index, 279u);
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::missing_end_of_string);
+    }
+
+    TEST_CASE("Iteration over nested values")
+    {
+        std::array<nanojsoncpp::json_value_desc, 30u> descriptors;
+
+        std::string json_input_obj1 = R"([{"a":[1,[2,3]],"b":{"c":{}}}, 4, [], [[5]], "end"])";
+
+        auto root1 = nanojsoncpp::parse(json_input_obj1, descriptors);
+        REQUIRE(root1);
+        CHECK_EQ(root1->size(), 5u);
+
+        size_t count = 0u;
+        for (const auto& value : root1.value())
+        {
+            (void)value;
+            count++;
+        }
+        CHECK_EQ(count, 5u);
+
+        auto string1 = root1->get(4u);
+        REQUIRE(string1);
+        CHECK_EQ(string1->get(), "end");
+
+        auto object1 = root1->get(0u);
+        REQUIRE(object1);
+        CHECK_EQ(object1->size(), 2u);
+        auto object2 = object1->get("b");
+        REQUIRE(object2);
+        CHECK_EQ(object2->name(), "b");
+        CHECK_FALSE(object2->get("c")->begin() != object2->get("c")->end());
+
+        auto int1 = root1->get(1u);
+        REQUIRE(int1);
+        CHECK_FALSE(int1->begin() != int1->end());
+
+#ifdef NANOJSONCPP_USE_SUBTREE_SIZE
+        CHECK_EQ(descriptors[0u].subtree_size, 14u);
+        CHECK_EQ(descriptors[1u].subtree_size, 7u);
+        CHECK_EQ(descriptors[2u].subtree_size, 4u);
+        CHECK_EQ(descriptors[3u].subtree_size, 0u);
+        CHECK_EQ(descriptors[4u].subtree_size, 2u);
+        CHECK_EQ(descriptors[9u].subtree_size, 0u);
+        CHECK_EQ(descriptors[11u].subtree_size, 2u);
+        CHECK_EQ(descriptors[15u].subtree_size, 0u);
+#endif // NANOJSONCPP_USE_SUBTREE_SIZE
+    }
+
+    TEST_CASE("Array random access")
+    {
+        std::array<nanojsoncpp::json_value_desc, 30u> descriptors;
+
+        std::string json_input_obj1 = R"({"flat": [10, 11, 12, 13], "mixed": [0, [1, [2]], {"a": 3}, 4], "empty": [], "obj": {"b": 5}})";
+
+        auto root1 = nanojsoncpp::parse(json_input_obj1, descriptors);
+        REQUIRE(root1);
+        CHECK_FALSE(root1->is_flat());
+
+        // Array without nested objects/arrays
+        auto array1 = root1->get("flat");
+        REQUIRE(array1);
+        CHECK(array1->is_flat());
+        for (nanojsoncpp::json_size_t i = 0u; i < array1->size(); i++)
+        {
+            auto value = array1->get(i);
+            REQUIRE(value);
+            CHECK_EQ(value->get<int>(), static_cast<int>(10u + i));
+        }
+        CHECK_FALSE(array1->get(4u));
+
+        auto array2 = root1->get("empty");
+        REQUIRE(array2);
+        CHECK(array2->is_flat());
+        CHECK_FALSE(array2->get(0u));
+
+        auto object1 = root1->get("obj");
+        REQUIRE(object1);
+        CHECK(object1->is_flat());
+        CHECK_FALSE(object1->get(0u));
+
+        auto int1 = object1->get("b");
+        REQUIRE(int1);
+        CHECK_FALSE(int1->is_flat());
+
+        // Array with nested objects/arrays
+        auto array3 = root1->get("mixed");
+        REQUIRE(array3);
+        CHECK_FALSE(array3->is_flat());
+        CHECK_EQ(array3->get(3u)->get<int>(), 4);
+
+        std::array<nanojsoncpp::json_size_t, 3u> small_storage;
+        CHECK_FALSE(nanojsoncpp::json_array_index::build(array3.value(), small_storage));
+        CHECK_FALSE(nanojsoncpp::json_array_index::build(object1.value(), small_storage));
+
+        std::array<nanojsoncpp::json_size_t, 10u> storage;
+        auto                                      index = nanojsoncpp::json_array_index::build(array3.value(), storage);
+        REQUIRE(index);
+        CHECK_EQ(index->size(), 4u);
+        CHECK_EQ(index->get(0u)->get<int>(), 0);
+        CHECK_EQ(index->get(1u)->type(), nanojsoncpp::json_value_type::array);
+        CHECK_EQ(index->get(1u)->get(1u)->get(0u)->get<int>(), 2);
+        CHECK_EQ(index->get(2u)->get("a")->get<int>(), 3);
+        CHECK_EQ((*index)[3u].get<int>(), 4);
+        CHECK_FALSE(index->get(4u));
+
+        auto it = index->begin();
+        CHECK_EQ((index->end() - it), 4);
+        CHECK_EQ((*(it + 3u)).get<int>(), 4);
+        CHECK_EQ(it[2u].type(), nanojsoncpp::json_value_type::object);
+        it += 1u;
+        CHECK_EQ((*it).type(), nanojsoncpp::json_value_type::array);
+        ++it;
+        --it;
+        CHECK(it < index->end());
+        CHECK(it == (index->begin() + 1u));
+
+        auto it2 = index->end();
+        it2--;
+        CHECK_EQ((*it2).get<int>(), 4);
+        it2 -= 3;
+        CHECK(it2 == index->begin());
+        CHECK_EQ((*(it2++)).get<int>(), 0);
+        CHECK((2 + it2) == (index->end() - 1));
+        CHECK(index->end() > it2);
+        CHECK(it2 <= it2);
+        CHECK(it2 >= index->begin());
+
+        size_t count = 0u;
+        for (const auto& value : index.value())
+        {
+            (void)value;
+            count++;
+        }
+        CHECK_EQ(count, 4u);
+
+        // Standard algorithms
+        using iterator_traits = std::iterator_traits<nanojsoncpp::json_array_index::iterator>;
+        CHECK(std::is_same_v<iterator_traits::iterator_category, std::random_access_iterator_tag>);
+        CHECK(std::is_same_v<iterator_traits::value_type, nanojsoncpp::json_value>);
+        CHECK(std::is_same_v<iterator_traits::difference_type, ptrdiff_t>);
+        CHECK_EQ(std::distance(index->begin(), index->end()), 4);
+
+        auto found = std::find_if(index->begin(), index->end(), [](const nanojsoncpp::json_value& value) { return value.is_object(); });
+        CHECK_EQ((found - index->begin()), 2);
+
+        std::array<nanojsoncpp::json_size_t, 4u> flat_storage;
+        auto                                     flat_index = nanojsoncpp::json_array_index::build(array1.value(), flat_storage);
+        REQUIRE(flat_index);
+        auto lower = std::lower_bound(flat_index->begin(),
+                                      flat_index->end(),
+                                      12,
+                                      [](const nanojsoncpp::json_value& value, int expected) { return (value.get<int>() < expected); });
+        CHECK_EQ((lower - flat_index->begin()), 2);
+        CHECK_EQ((*lower).get<int>(), 12);
+
+        // Array of empty objects/arrays
+        std::string json_input_obj2 = R"([[], {}, 1])";
+
+        auto root2 = nanojsoncpp::parse(json_input_obj2, descriptors);
+        REQUIRE(root2);
+        CHECK(root2->is_flat());
+        CHECK_EQ(root2->get(0u)->type(), nanojsoncpp::json_value_type::array);
+        CHECK_EQ(root2->get(1u)->type(), nanojsoncpp::json_value_type::object);
+        CHECK_EQ(root2->get(2u)->get<int>(), 1);
+    }
+
+    TEST_CASE("Object hash index")
+    {
+        std::array<nanojsoncpp::json_value_desc, 30u> descriptors;
+
+        std::string json_input_obj1 =
+            R"({"a": 1, "b": [2, 3], "c": {"d": 4}, "e": "five", "a": 6, "f": null, "g": true, "h": 8, "": 9, "ab": 10})";
+
+        auto root1 = nanojsoncpp::parse(json_input_obj1, descriptors);
+        REQUIRE(root1);
+        CHECK_EQ(root1->size(), 10u);
+
+        // Storage too small
+        std::array<nanojsoncpp::json_size_t, 10u> small_storage;
+        CHECK_FALSE(nanojsoncpp::json_object_index::build(root1.value(), small_storage));
+        CHECK_FALSE(nanojsoncpp::json_object_index::build(root1->get("b").value(), small_storage));
+
+        // Minimum storage and recommended storage
+        static_assert(nanojsoncpp::json_object_index::get_storage_size(0u) == 2u);
+        static_assert(nanojsoncpp::json_object_index::get_storage_size(10u) == 32u);
+        std::array<nanojsoncpp::json_size_t, 17u> min_storage;
+        std::array<nanojsoncpp::json_size_t, nanojsoncpp::json_object_index::get_storage_size(10u)> storage;
+        for (const auto& index : {nanojsoncpp::json_object_index::build(root1.value(), min_storage),
+                                  nanojsoncpp::json_object_index::build(root1.value(), storage)})
+        {
+            REQUIRE(index);
+            for (const auto& value : root1.value())
+            {
+                auto indexed_value = index->get(value.name());
+                REQUIRE(indexed_value);
+                CHECK_EQ(indexed_value->name(), value.name());
+                CHECK_EQ(indexed_value->type(), value.type());
+                CHECK_EQ(indexed_value->get(), root1->get(value.name())->get());
+            }
+
+            // First member is returned when a name is used several times
+            CHECK_EQ((*index)["a"]->get<int>(), 1);
+            CHECK_EQ((*index)["c"]->get("d")->get<int>(), 4);
+            CHECK_EQ((*index)["h"]->get<int>(), 8);
+            CHECK_EQ((*index)[""]->get<int>(), 9);
+            CHECK_FALSE(index->get("d"));
+            CHECK_FALSE(index->get("abc"));
+            CHECK_FALSE(index->get("A"));
+        }
+
+        // Precomputed keys
+        auto index3 = nanojsoncpp::json_object_index::build(root1.value(), storage);
+        REQUIRE(index3);
+        constexpr nanojsoncpp::json_key key_h("h");
+        constexpr nanojsoncpp::json_key key_z("z");
+        CHECK_EQ(index3->get(key_h)->get<int>(), 8);
+        CHECK_EQ((*index3)[key_h]->get<int>(), 8);
+        CHECK_FALSE(index3->get(key_z));
+
+        // Empty object
+        std::string json_input_obj2 = R"({})";
+        auto        root2           = nanojsoncpp::parse(json_input_obj2, descriptors);
+        REQUIRE(root2);
+        auto index2 = nanojsoncpp::json_object_index::build(root2.value(), small_storage);
+        REQUIRE(index2);
+        CHECK_FALSE(index2->get("a"));
+
+        // Empty storage
+        CHECK_FALSE(nanojsoncpp::json_object_index::build(root2.value(), std::span<nanojsoncpp::json_size_t>()));
+        CHECK_FALSE(nanojsoncpp::json_object_index::build(root1.value(), std::span<nanojsoncpp::json_size_t>()));
+        std::array<nanojsoncpp::json_size_t, 1u> single_storage;
+        auto                                     index4 = nanojsoncpp::json_object_index::build(root2.value(), single_storage);
+        REQUIRE(index4);
+        CHECK_FALSE(index4->get("a"));
+    }
+
+    TEST_CASE("Precomputed keys")
+    {
+        std::array<nanojsoncpp::json_value_desc, 30u> descriptors;
+
+        std::string json_input_obj1 = R"({"ab": 1, "ba": 2, "a": {"ab": 3}, "abc": 4, "ab": 5, "": 6, "a\"b": 7})";
+
+        auto root1 = nanojsoncpp::parse(json_input_obj1, descriptors);
+        REQUIRE(root1);
+
+        constexpr nanojsoncpp::json_key key_ab("ab");
+        static_assert(key_ab.hash() == nanojsoncpp::hash_name("ab"));
+        CHECK_EQ(key_ab.name(), "ab");
+        CHECK_EQ(root1->get(key_ab)->get<int>(), 1);
+        CHECK_EQ((*root1)[key_ab]->get<int>(), 1);
+        CHECK_EQ(root1->get(nanojsoncpp::json_key("ba"))->get<int>(), 2);
+        CHECK_EQ(root1->get(nanojsoncpp::json_key("abc"))->get<int>(), 4);
+        CHECK_EQ(root1->get(nanojsoncpp::json_key(""))->get<int>(), 6);
+        CHECK_EQ(root1->get(nanojsoncpp::json_key(R"(a\"b)"))->get<int>(), 7);
+        CHECK_EQ(root1->get("a")->get(key_ab)->get<int>(), 3);
+        CHECK_FALSE(root1->get(nanojsoncpp::json_key("b")));
+        CHECK_FALSE(root1->get(nanojsoncpp::json_key("abcd")));
+        CHECK_FALSE(root1->get("a")->get("ab")->get(key_ab));
+
+        // Same results using names
+        CHECK_EQ(root1->get("ab")->get<int>(), 1);
+        CHECK_EQ(root1->get("")->get<int>(), 6);
+        CHECK_FALSE(root1->get("abcd"));
+
+#ifdef NANOJSONCPP_USE_NAME_HASH
+        CHECK_EQ(descriptors[1u].name_hash, static_cast<nanojsoncpp::json_size_t>(nanojsoncpp::hash_name("ab")));
+        CHECK_EQ(descriptors[3u].name_hash, static_cast<nanojsoncpp::json_size_t>(nanojsoncpp::hash_name("a")));
+        CHECK_EQ(descriptors[4u].name_hash, static_cast<nanojsoncpp::json_size_t>(nanojsoncpp::hash_name("ab")));
+#endif // NANOJSONCPP_USE_NAME_HASH
+    }
+
+    TEST_CASE("Numbers converted during parsing")
+    {
+        std::array<nanojsoncpp::json_value_desc, 20u> descriptors;
+        std::array<nanojsoncpp::json_number, 20u>     numbers;
+        std::array<nanojsoncpp::json_value_desc, 20u> ref_descriptors;
+
+        std::string json_input = R"({"int": -123, "dec": 45.5e2, "str": "12", "array": [1, 2.5, [3], {"a": 4}], "obj": {"b": 5, "c": 6.25}})";
+
+        auto root = nanojsoncpp::parse(json_input, descriptors, numbers);
+        REQUIRE(root);
+        CHECK(root->has_numbers());
+        CHECK_EQ(root->get("int")->get<int>(), -123);
+        CHECK_EQ(root->get("int")->get<double>(), -123.);
+        CHECK_EQ(root->get("dec")->get<nanojsoncpp::json_float_t>(), static_cast<nanojsoncpp::json_float_t>(4550.));
+        CHECK_EQ(root->get("str")->get<int>(), 12);
+        CHECK_EQ(root->get("array")->get(1u)->get<nanojsoncpp::json_float_t>(), static_cast<nanojsoncpp::json_float_t>(2.5));
+        CHECK_EQ(root->get("array")->get(2u)->get(0u)->get<int>(), 3);
+        CHECK_EQ(root->get("array")->get(3u)->get("a")->get<int>(), 4);
+        CHECK_EQ(root->get("obj")->get("c")->get<nanojsoncpp::json_float_t>(), static_cast<nanojsoncpp::json_float_t>(6.25));
+
+        // Same descriptors as parse()
+        auto ref_root = nanojsoncpp::parse(json_input, ref_descriptors);
+        REQUIRE(ref_root);
+        CHECK_FALSE(ref_root->has_numbers());
+        for (size_t i = 0u; i < 14u; i++)
+        {
+            CHECK_EQ(descriptors[i].type, ref_descriptors[i].type);
+            CHECK_EQ(descriptors[i].nesting_level, ref_descriptors[i].nesting_level);
+            CHECK_EQ(descriptors[i].value_start, ref_descriptors[i].value_start);
+            CHECK_EQ(descriptors[i].value_size, ref_descriptors[i].value_size);
+        }
+
+        // The numbers are indexed like the descriptors and get<T>() only loads them
+        CHECK_EQ(numbers[1u].integer, -123);
+        numbers[1u].integer = 321;
+        CHECK_EQ(root->get("int")->get<int>(), 321);
+        numbers[1u].integer = -123;
+
+        // Iterators and indexes
+        auto array = root->get("array");
+        REQUIRE(array);
+        int sum = 0;
+        for (const auto& value : array.value())
+        {
+            if (value.is_integer())
+            {
+                sum += value.get<int>();
+            }
+        }
+        CHECK_EQ(sum, 1);
+        std::array<nanojsoncpp::json_size_t, 4u> array_storage;
+        auto array_index = nanojsoncpp::json_array_index::build(array.value(), array_storage);
+        REQUIRE(array_index);
+        CHECK_EQ((*array_index)[3u].get("a")->get<int>(), 4);
+        std::array<nanojsoncpp::json_size_t, 8u> object_storage;
+        auto object_index = nanojsoncpp::json_object_index::build(root.value(), object_storage);
+        REQUIRE(object_index);
+        CHECK(object_index->get("int")->has_numbers());
+        CHECK_EQ(object_index->get("obj")->get("b")->get<int>(), 5);
+
+        // Only the descriptors which have a number are used
+        nanojsoncpp::json_parse_error error = nanojsoncpp::json_parse_error::no_error;
+        CHECK_FALSE(nanojsoncpp::parse(json_input,
+                                       descriptors,
+                                       std::span<nanojsoncpp::json_number>(numbers).first(5u),
+                                       [&](nanojsoncpp::json_size_t, nanojsoncpp::json_parse_error _error) { error = _error; }));
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::not_enough_memory);
+
+        // Integers of any length are converted as to_int() does, including the ones too long to be converted while parsing
+        std::string json_integers = "[";
+        std::string digits;
+        for (size_t i = 0u; i < 8u; i++)
+        {
+            digits += static_cast<char>('1' + i);
+            json_integers += digits + ", -" + digits + ", ";
+        }
+        json_integers += std::to_string(std::numeric_limits<nanojsoncpp::json_int_t>::max()) + ", ";
+        json_integers += std::to_string(std::numeric_limits<nanojsoncpp::json_int_t>::min()) + "]";
+        auto integers = nanojsoncpp::parse(json_integers, descriptors, numbers);
+        REQUIRE(integers);
+        REQUIRE_EQ(integers->size(), 18u);
+        for (nanojsoncpp::json_size_t i = 0u; i < integers->size(); i++)
+        {
+            auto integer = integers->get(i);
+            REQUIRE(integer);
+            CHECK(integer->is_integer());
+            CHECK_EQ(numbers[i + 1u].integer, nanojsoncpp::to_int(integer->get()));
+        }
+        CHECK_EQ(numbers[15u].integer, 12345678);
+        CHECK_EQ(numbers[16u].integer, -12345678);
+        CHECK_EQ(numbers[17u].integer, std::numeric_limits<nanojsoncpp::json_int_t>::max());
+        CHECK_EQ(numbers[18u].integer, std::numeric_limits<nanojsoncpp::json_int_t>::min());
+    }
+
+    TEST_CASE("Array of numbers conversion")
+    {
+        std::array<nanojsoncpp::json_value_desc, 20u> descriptors;
+        std::array<nanojsoncpp::json_number, 20u>     numbers;
+
+        std::string json_input = R"({"mixed": [1, -2, 3.5, 4e2, 12345678901234567890], "int": [10, 20, 30], "nested": [5, [6]], "empty": []})";
+
+        for (bool with_numbers : {false, true})
+        {
+            auto root = (with_numbers ? nanojsoncpp::parse(json_input, descriptors, numbers) : nanojsoncpp::parse(json_input, descriptors));
+            REQUIRE(root);
+            CHECK_EQ(root->has_numbers(), with_numbers);
+            auto mixed = root->get("mixed");
+            REQUIRE(mixed);
+
+            // Floating point storage accepts integers and decimals, the values are the same as with get<T>()
+            std::array<double, 5u> doubles;
+            auto                   result = mixed->get_array(std::span<double>(doubles));
+            CHECK_EQ(result.error, nanojsoncpp::json_array_error::no_error);
+            CHECK_EQ(result.count, 5u);
+            for (nanojsoncpp::json_size_t i = 0u; i < result.count; i++)
+            {
+                CHECK_EQ(doubles[i], mixed->get(i)->get<double>());
+            }
+            CHECK_EQ(doubles[1u], -2.);
+            CHECK_EQ(doubles[2u], 3.5);
+            CHECK_EQ(doubles[3u], 400.);
+            std::array<float, 5u> floats;
+            result = mixed->get_array(std::span<float>(floats));
+            CHECK_EQ(result.error, nanojsoncpp::json_array_error::no_error);
+            CHECK_EQ(floats[4u], mixed->get(4u)->get<float>());
+
+            // Integral storage only accepts integers : the elements preceding the first decimal are converted
+            std::array<int, 5u> ints = {};
+            result                   = mixed->get_array(std::span<int>(ints));
+            CHECK_EQ(result.error, nanojsoncpp::json_array_error::mixed_types);
+            CHECK_EQ(result.count, 2u);
+            CHECK_EQ(ints[0u], 1);
+            CHECK_EQ(ints[1u], -2);
+            result = root->get("int")->get_array(std::span<int>(ints));
+            CHECK_EQ(result.error, nanojsoncpp::json_array_error::no_error);
+            CHECK_EQ(result.count, 3u);
+            CHECK_EQ(ints[2u], 30);
+
+            // Errors
+            result = root->get("int")->get_array(std::span<int>(ints).first(2u));
+            CHECK_EQ(result.error, nanojsoncpp::json_array_error::not_enough_memory);
+            CHECK_EQ(result.count, 0u);
+            result = root->get_array(std::span<int>(ints));
+            CHECK_EQ(result.error, nanojsoncpp::json_array_error::not_an_array);
+            result = root->get("nested")->get_array(std::span<int>(ints));
+            CHECK_EQ(result.error, nanojsoncpp::json_array_error::mixed_types);
+            CHECK_EQ(result.count, 1u);
+            CHECK_EQ(ints[0u], 5);
+            result = root->get("empty")->get_array(std::span<int>());
+            CHECK_EQ(result.error, nanojsoncpp::json_array_error::no_error);
+            CHECK_EQ(result.count, 0u);
+        }
+    }
+
+    TEST_CASE("Columns extraction")
+    {
+        std::array<nanojsoncpp::json_value_desc, 40u> descriptors;
+        std::array<nanojsoncpp::json_number, 40u>     numbers;
+
+        // The third object has another key order and the fourth one has a nested member with the same name as a column
+        std::string json_input = R"([{"t": 1.5, "v": 10, "q": "a", "ok": true},
+                                     {"t": 2.5, "v": -20, "q": "b", "ok": false},
+                                     {"v": 30, "q": "c", "t": 3, "ok": true},
+                                     {"meta": {"v": 99}, "t": 4.25, "v": 40, "q": "d", "ok": false}])";
+
+        for (bool with_numbers : {false, true})
+        {
+            auto root = (with_numbers ? nanojsoncpp::parse(json_input, descriptors, numbers) : nanojsoncpp::parse(json_input, descriptors));
+            REQUIRE(root);
+
+            std::array<double, 4u>           t;
+            std::array<int, 4u>              v;
+            std::array<std::string_view, 4u> q;
+            std::array<bool, 4u>             ok;
+
+            std::array<nanojsoncpp::json_column, 4u> columns = {
+                nanojsoncpp::json_column(nanojsoncpp::json_key("t"), std::span<double>(t)),
+                nanojsoncpp::json_column(nanojsoncpp::json_key("v"), std::span<int>(v)),
+                nanojsoncpp::json_column(nanojsoncpp::json_key("q"), std::span<std::string_view>(q)),
+                nanojsoncpp::json_column(nanojsoncpp::json_key("ok"), std::span<bool>(ok))};
+            auto result = root->get_columns(columns);
+            CHECK_EQ(result.error, nanojsoncpp::json_array_error::no_error);
+            CHECK_EQ(result.count, 4u);
+            CHECK_EQ(t, std::array<double, 4u>{1.5, 2.5, 3., 4.25});
+            CHECK_EQ(v, std::array<int, 4u>{10, -20, 30, 40});
+            CHECK_EQ(q, std::array<std::string_view, 4u>{"a", "b", "c", "d"});
+            CHECK_EQ(ok, std::array<bool, 4u>{true, false, true, false});
+
+            // Statistics over the filled columns
+            auto t_stats = nanojsoncpp::get_stats(std::span<double>(t).first(result.count));
+            REQUIRE(t_stats);
+            CHECK_EQ(t_stats->min, 1.5);
+            CHECK_EQ(t_stats->max, 4.25);
+            CHECK_EQ(t_stats->sum, 11.25);
+            auto v_stats = nanojsoncpp::get_stats(std::span<const int>(v));
+            REQUIRE(v_stats);
+            CHECK_EQ(v_stats->min, -20);
+            CHECK_EQ(v_stats->max, 40);
+            CHECK_EQ(v_stats->sum, 60);
+
+            // Errors, the objects preceding the invalid one are extracted
+            std::array<nanojsoncpp::json_column, 1u> int_t = {nanojsoncpp::json_column(nanojsoncpp::json_key("t"), std::span<int>(v))};
+            result                                         = root->get_columns(int_t);
+            CHECK_EQ(result.error, nanojsoncpp::json_array_error::mixed_types);
+            CHECK_EQ(result.count, 0u);
+            std::array<nanojsoncpp::json_column, 1u> meta = {nanojsoncpp::json_column(nanojsoncpp::json_key("meta"), std::span<int>(v))};
+            result                                        = root->get_columns(meta);
+            CHECK_EQ(result.error, nanojsoncpp::json_array_error::missing_member);
+            CHECK_EQ(result.count, 0u);
+            std::array<nanojsoncpp::json_column, 1u> small = {
+                nanojsoncpp::json_column(nanojsoncpp::json_key("v"), std::span<int>(v).first(3u))};
+            result = root->get_columns(small);
+            CHECK_EQ(result.error, nanojsoncpp::json_array_error::not_enough_memory);
+            result = root->get(0u)->get_columns(columns);
+            CHECK_EQ(result.error, nanojsoncpp::json_array_error::not_an_array);
+        }
+
+        std::string json_mixed = R"([{"v": 1}, {"v": 2}, 3])";
+        auto        mixed      = nanojsoncpp::parse(json_mixed, descriptors);
+        REQUIRE(mixed);
+        std::array<int, 3u>                      v;
+        std::array<nanojsoncpp::json_column, 1u> columns = {nanojsoncpp::json_column(nanojsoncpp::json_key("v"), std::span<int>(v))};
+        auto                                     result  = mixed->get_columns(columns);
+        CHECK_EQ(result.error, nanojsoncpp::json_array_error::not_an_object);
+        CHECK_EQ(result.count, 2u);
+        CHECK_EQ(v[1u], 2);
+
+        // Statistics use independent lanes : check the blocks and the remaining values
+        std::array<int64_t, 21u> values;
+        for (size_t i = 0u; i < values.size(); i++)
+        {
+            values[i] = static_cast<int64_t>((i * 37u) % 23u) - 11;
+        }
+        values[13u] = -50;
+        values[20u] = 60;
+        auto stats  = nanojsoncpp::get_stats(std::span<int64_t>(values));
+        REQUIRE(stats);
+        CHECK_EQ(stats->min, -50);
+        CHECK_EQ(stats->max, 60);
+        int64_t sum = 0;
+        for (int64_t value : values)
+        {
+            sum += value;
+        }
+        CHECK_EQ(stats->sum, sum);
+        CHECK_FALSE(nanojsoncpp::get_stats(std::span<float>()));
+    }
+
+    TEST_CASE("Error handlers")
+    {
+        std::array<nanojsoncpp::json_value_desc, 10u> descriptors;
+
+        std::string json_input_ok  = R"({"a": [1, 2]})";
+        std::string json_input_err = R"({"a": [1, 2})";
+
+        // Functor
+        struct error_counter
+        {
+            size_t                        count = 0u;
+            nanojsoncpp::json_size_t      index = 0u;
+            nanojsoncpp::json_parse_error error = nanojsoncpp::json_parse_error::no_error;
+            void                          operator()(nanojsoncpp::json_size_t _index, nanojsoncpp::json_parse_error _error)
+            {
+                count++;
+                index = _index;
+                error = _error;
+            }
+        };
+        error_counter counter;
+        CHECK(nanojsoncpp::parse(json_input_ok, descriptors, counter));
+        CHECK_EQ(counter.count, 0u);
+        CHECK_FALSE(nanojsoncpp::parse(json_input_err, descriptors, counter));
+        CHECK_EQ(counter.count, 1u);
+        CHECK_EQ(counter.index, 12u);
+        CHECK_EQ(counter.error, nanojsoncpp::json_parse_error::unexpected_char);
+
+        // No error handler
+        auto root1 = nanojsoncpp::parse(json_input_ok, descriptors, nanojsoncpp::no_error_handler());
+        REQUIRE(root1);
+        CHECK_EQ(root1->get("a")->size(), 2u);
+        CHECK_FALSE(nanojsoncpp::parse(json_input_err, descriptors, nanojsoncpp::no_error_handler()));
+        CHECK_FALSE(nanojsoncpp::parse(json_input_err, descriptors, nullptr));
+        CHECK_FALSE(nanojsoncpp::parse(json_input_err, descriptors));
+
+        // std::function
+        size_t                             count   = 0u;
+        nanojsoncpp::parse_error_handler_t handler = [&count](nanojsoncpp::json_size_t, nanojsoncpp::json_parse_error) { count++; };
+        CHECK_FALSE(nanojsoncpp::parse(json_input_err, descriptors, handler));
+        CHECK_EQ(count, 1u);
+        nanojsoncpp::parse_error_handler_t empty_handler;
+        CHECK_FALSE(nanojsoncpp::parse(json_input_err, descriptors, empty_handler));
+    }
+
+    TEST_CASE("Stream parsing")
+    {
+        std::array<nanojsoncpp::json_value_desc, 30u> ref_descriptors;
+        std::array<nanojsoncpp::json_value_desc, 30u> descriptors;
+        std::array<char, 300u>                        buffer;
+
+        std::string json_input = R"({
+            "id": 12345,
+            "name": "sensor \"A\"",
+            "enabled": true,
+            "limits": { "min": -1.5, "max": 10.25 },
+            "samples": [1, 2, [3, 4], { "x": null }],
+            "status": false
+        })";
+        auto        ref_root   = nanojsoncpp::parse(json_input, ref_descriptors);
+        REQUIRE(ref_root);
+
+        // All the chunk sizes must give the same result as a single call to parse()
+        for (size_t chunk_size = 1u; chunk_size <= json_input.size(); chunk_size++)
+        {
+            nanojsoncpp::json_stream_parser parser(buffer, descriptors);
+            std::vector<std::string>        completed;
+            for (size_t i = 0u; i < json_input.size(); i += chunk_size)
+            {
+                REQUIRE(parser.feed(std::string_view(json_input).substr(i, chunk_size)));
+                while (auto value = parser.next_completed())
+                {
+                    completed.emplace_back(value->name());
+                }
+            }
+            CHECK(parser.is_complete());
+            auto root = parser.finish();
+            REQUIRE(root);
+            CHECK_FALSE(parser.next_completed());
+            CHECK_EQ(completed, std::vector<std::string>{"id", "name", "enabled", "limits", "samples", "status"});
+            CHECK_EQ(root->size(), ref_root->size());
+            size_t i = 0u;
+            do
+            {
+                CHECK_EQ(descriptors[i].nesting_level, ref_descriptors[i].nesting_level);
+                CHECK_EQ(descriptors[i].type, ref_descriptors[i].type);
+                CHECK_EQ(descriptors[i].name_start, ref_descriptors[i].name_start);
+                CHECK_EQ(descriptors[i].name_size, ref_descriptors[i].name_size);
+                CHECK_EQ(descriptors[i].value_start, ref_descriptors[i].value_start);
+                CHECK_EQ(descriptors[i].value_size, ref_descriptors[i].value_size);
+                i++;
+            } while (ref_descriptors[i].nesting_level != 0u);
+        }
+
+        // Long strings received in many chunks, with escaped chars split between the chunks
+        std::string long_value;
+        for (size_t i = 0u; i < 40u; i++)
+        {
+            long_value += "some text \\\"quoted\\\" \\u00e9\\ud83d\\ude00 \xC3\xA9\\n";
+        }
+        const std::string long_input = R"({"ascii": ")" + std::string(1000u, 'a') + R"(", "long": ")" + long_value + R"("})";
+        std::array<nanojsoncpp::json_value_desc, 4u> long_ref_descriptors;
+        std::array<nanojsoncpp::json_value_desc, 4u> long_descriptors;
+        std::array<char, 4096u>                      long_buffer;
+        auto                                         long_ref_root = nanojsoncpp::parse(long_input, long_ref_descriptors);
+        REQUIRE(long_ref_root);
+        for (size_t chunk_size : {1u, 5u, 64u})
+        {
+            nanojsoncpp::json_stream_parser long_parser(long_buffer, long_descriptors);
+            for (size_t i = 0u; i < long_input.size(); i += chunk_size)
+            {
+                REQUIRE(long_parser.feed(std::string_view(long_input).substr(i, chunk_size)));
+            }
+            auto long_root = long_parser.finish();
+            REQUIRE(long_root);
+            CHECK_EQ(long_root->get("ascii")->get(), std::string(1000u, 'a'));
+            CHECK_EQ(long_root->get("ascii")->is_ascii(), long_ref_root->get("ascii")->is_ascii());
+            CHECK_EQ(long_root->get("long")->get(), long_value);
+            CHECK_EQ(long_root->get("long")->is_ascii(), long_ref_root->get("long")->is_ascii());
+        }
+
+        // Completed members can be processed before the end of the json string
+        nanojsoncpp::json_stream_parser parser(buffer, descriptors);
+        const size_t                    limits_end = json_input.find("},") + 1u;
+        CHECK(parser.feed(std::string_view(json_input).substr(0u, limits_end)));
+        CHECK_FALSE(parser.is_complete());
+        CHECK_EQ(parser.next_completed()->get<int>(), 12345);
+        CHECK_EQ(parser.next_completed()->get(), "sensor \\\"A\\\"");
+        CHECK(parser.next_completed()->get<bool>());
+        auto limits = parser.next_completed();
+        REQUIRE(limits);
+        CHECK_EQ(limits->size(), 2u);
+        CHECK_EQ(limits->get("max")->get<nanojsoncpp::json_float_t>(), static_cast<nanojsoncpp::json_float_t>(10.25));
+        CHECK_FALSE(parser.next_completed());
+        CHECK(parser.feed(std::string_view(json_input).substr(limits_end, 20u)));
+        CHECK_FALSE(parser.next_completed());
+        CHECK(parser.feed(std::string_view(json_input).substr(limits_end + 20u)));
+        CHECK(parser.finish());
+
+        // Reuse for another json string, with trailing blank chars
+        parser.reset();
+        CHECK(parser.feed("  [ 1, 2"));
+        CHECK_EQ(parser.next_completed()->get<int>(), 1);
+        CHECK_FALSE(parser.next_completed());
+        CHECK(parser.feed(", 3]  "));
+        CHECK(parser.feed("\r\n"));
+        auto array = parser.finish();
+        REQUIRE(array);
+        CHECK_EQ(array->size(), 3u);
+        CHECK_EQ(parser.get_json_string(), "  [ 1, 2, 3]  \r\n");
+
+        // Errors are reported as soon as they are received, at the same index as parse()
+        nanojsoncpp::json_size_t        error_index = 0u;
+        nanojsoncpp::json_parse_error   error       = nanojsoncpp::json_parse_error::no_error;
+        auto                            on_error    = [&](nanojsoncpp::json_size_t _error_index, nanojsoncpp::json_parse_error _error)
+        {
+            error_index = _error_index;
+            error       = _error;
+        };
+        nanojsoncpp::json_stream_parser error_parser(buffer, descriptors, on_error);
+        CHECK(error_parser.feed(R"({"a": [1, 2)"));
+        CHECK_FALSE(error_parser.feed("}"));
+        CHECK_EQ(error_index, 12u);
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::unexpected_char);
+        CHECK_FALSE(error_parser.feed("]}"));
+        CHECK_FALSE(error_parser.finish());
+
+        // Trailing chars
+        error_parser.reset();
+        CHECK(error_parser.feed("{} "));
+        CHECK(error_parser.is_complete());
+        CHECK_FALSE(error_parser.feed(" x"));
+        CHECK_EQ(error_index, 2u);
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::trailing_chars);
+
+        // Incomplete json strings
+        error_parser.reset();
+        CHECK(error_parser.feed(R"({"a": tru)"));
+        CHECK_FALSE(error_parser.finish());
+        CHECK_EQ(error_index, 6u);
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::invalid_value);
+        error_parser.reset();
+        CHECK(error_parser.feed(R"({"a": "x)"));
+        CHECK_FALSE(error_parser.finish());
+        CHECK_EQ(error_index, 7u);
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::missing_end_of_string);
+        error_parser.reset();
+        CHECK(error_parser.feed(R"({"a": "x\n)"));
+        CHECK(error_parser.feed(R"(yz\u00)"));
+        CHECK_FALSE(error_parser.finish());
+        CHECK_EQ(error_index, 12u);
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::missing_end_of_string);
+        error_parser.reset();
+        CHECK(error_parser.feed(R"({"a": "x\n)"));
+        CHECK(error_parser.feed("yz\\"));
+        CHECK_FALSE(error_parser.feed("x\""));
+        CHECK_EQ(error_index, 12u);
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::invalid_escaped_char);
+        error_parser.reset();
+        CHECK(error_parser.feed(R"({"a": [1])"));
+        CHECK_FALSE(error_parser.finish());
+        CHECK_EQ(error_index, 10u);
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::unexpected_end_of_json_string);
+        error_parser.reset();
+        CHECK(error_parser.feed("   "));
+        CHECK_FALSE(error_parser.finish());
+        CHECK_EQ(error_index, 0u);
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::not_a_json_string);
+
+        // Buffer too small
+        error_parser.reset();
+        CHECK(error_parser.feed(std::string(250u, ' ')));
+        CHECK_FALSE(error_parser.feed(std::string(51u, ' ')));
+        CHECK_EQ(error_index, 250u);
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::json_too_big);
+    }
+
+    TEST_CASE("Event parsing")
+    {
+        // Record all the events
+        struct event_recorder
+        {
+            std::string events;
+            void        on_object_begin() { events += "{"; }
+            void        on_object_end() { events += "}"; }
+            void        on_array_begin() { events += "["; }
+            void        on_array_end() { events += "]"; }
+            void        on_key(const std::string_view& name) { events += std::string(name) + ":"; }
+            void        on_null() { events += "null,"; }
+            void        on_bool(bool value) { events += (value ? "true," : "false,"); }
+            void        on_string(const std::string_view& value) { events += "'" + std::string(value) + "',"; }
+            void        on_integer(nanojsoncpp::json_int_t value) { events += std::to_string(value) + ","; }
+            void        on_decimal(nanojsoncpp::json_float_t value) { events += std::to_string(static_cast<int>(value * 100)) + "%,"; }
+        };
+
+        std::string json_input = R"({
+            "a": null, "b" : true, "c": false,
+            "d": "text \"quoted\"",
+            "e": [ -12, 3.5, [], {}, [ [ 0 ] ] ],
+            "f": { "g": { "h": "" } }
+        })";
+
+        event_recorder recorder;
+        CHECK(nanojsoncpp::parse_events(json_input, recorder));
+        CHECK_EQ(recorder.events, R"({a:null,b:true,c:false,d:'text \"quoted\"',e:[-12,350%,[]{}[[0,]]]f:{g:{h:'',}}})");
+
+        // Visitor only interested in some events
+        struct integer_sum : nanojsoncpp::json_visitor
+        {
+            nanojsoncpp::json_int_t sum = 0;
+            void                    on_integer(nanojsoncpp::json_int_t value) { sum += value; }
+        };
+        integer_sum sum;
+        CHECK(nanojsoncpp::parse_events("[1, 2, {\"a\": 3, \"b\": [4, 5.5]}, 6]", sum));
+        CHECK_EQ(sum.sum, 16);
+
+        // Errors
+        nanojsoncpp::json_size_t      error_index = 0u;
+        nanojsoncpp::json_parse_error error       = nanojsoncpp::json_parse_error::no_error;
+        auto                          on_error    = [&](nanojsoncpp::json_size_t _error_index, nanojsoncpp::json_parse_error _error)
+        {
+            error_index = _error_index;
+            error       = _error;
+        };
+        recorder.events.clear();
+        CHECK_FALSE(nanojsoncpp::parse_events(R"({"a": [1, 2})", recorder, on_error));
+        CHECK_EQ(error_index, 12u);
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::unexpected_char);
+        CHECK_EQ(recorder.events, "{a:[1,2,");
+        CHECK_FALSE(nanojsoncpp::parse_events(R"({"a": 1 )", recorder, on_error));
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::unexpected_end_of_json_string);
+        CHECK_FALSE(nanojsoncpp::parse_events("   ", recorder, on_error));
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::not_a_json_string);
+        CHECK_FALSE(nanojsoncpp::parse_events("[] x", recorder));
+
+        // Maximum nesting level
+        std::string too_deep(static_cast<size_t>(nanojsoncpp::MAX_NESTING_LEVEL) + 1u, '[');
+        too_deep += std::string(too_deep.size(), ']');
+        CHECK_FALSE(nanojsoncpp::parse_events(too_deep, recorder, on_error));
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::max_nesting_level);
+    }
+
+    TEST_CASE("Descriptors counting")
+    {
+        const std::vector<std::pair<std::string, nanojsoncpp::json_count>> inputs = {
+            {"[]", {2u, 1u}},
+            {" { } ", {2u, 1u}},
+            {R"({"a": 1, "b": [true, null, "x"], "c": {"d": {}}})", {9u, 3u}},
+            {"[[[[]], []], [[[1, 2.5]]]]", {11u, 4u}},
+            {R"([{"a": [1]}, {"b": [2, [3]]}, 4])", {11u, 4u}}};
+
+        for (const auto& [json_input, expected] : inputs)
+        {
+            auto count = nanojsoncpp::parse_count(json_input);
+            REQUIRE(count);
+            CHECK_EQ(count->descriptors, expected.descriptors);
+            CHECK_EQ(count->max_nesting_level, expected.max_nesting_level);
+
+            // The counted number of descriptors is the exact number needed by parse()
+            std::vector<nanojsoncpp::json_value_desc> descriptors(count->descriptors);
+            CHECK(nanojsoncpp::parse(json_input, descriptors));
+            descriptors.resize(count->descriptors - 1u);
+            CHECK_FALSE(nanojsoncpp::parse(json_input, descriptors));
+        }
+
+        // Errors are reported at the same index as parse()
+        nanojsoncpp::json_size_t      error_index = 0u;
+        nanojsoncpp::json_parse_error error       = nanojsoncpp::json_parse_error::no_error;
+        auto                          on_error    = [&](nanojsoncpp::json_size_t _error_index, nanojsoncpp::json_parse_error _error)
+        {
+            error_index = _error_index;
+            error       = _error;
+        };
+        CHECK_FALSE(nanojsoncpp::parse_count(R"({"a": [1, 2})", on_error));
+        CHECK_EQ(error_index, 12u);
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::unexpected_char);
+        CHECK_FALSE(nanojsoncpp::parse_count(R"({"a": "b\x"})", on_error));
+        CHECK_EQ(error_index, 8u);
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::invalid_escaped_char);
+        CHECK_FALSE(nanojsoncpp::parse_count("[1] 2", nanojsoncpp::no_error_handler()));
+
+        size_t                             count   = 0u;
+        nanojsoncpp::parse_error_handler_t handler = [&count](nanojsoncpp::json_size_t, nanojsoncpp::json_parse_error) { count++; };
+        CHECK_FALSE(nanojsoncpp::parse_count("[1, 2", handler));
+        CHECK_EQ(count, 1u);
+        CHECK_FALSE(nanojsoncpp::parse_count("{]"));
+    }
+
+    TEST_CASE("UTF-8 strings")
+    {
+        std::array<nanojsoncpp::json_value_desc, 8u> descriptors;
+        nanojsoncpp::json_size_t                     error_index = 0u;
+        nanojsoncpp::json_parse_error                error       = nanojsoncpp::json_parse_error::no_error;
+
+        auto on_error = [&](nanojsoncpp::json_size_t _error_index, nanojsoncpp::json_parse_error _error)
+        {
+            error_index = _error_index;
+            error       = _error;
+        };
+
+        // Valid sequences of 1 to 4 bytes, including the limits of each range
+        const std::string json_input = "{\"ascii\": \"a long ASCII string with \\\"escapes\\\"\", "
+                                       "\"caf\xC3\xA9\": \"\xE2\x82\xAC \xF0\x9F\x98\x80\", "
+                                       "\"limits\": [\"\xC2\x80\xDF\xBF\xE0\xA0\x80\xED\x9F\xBF\xEE\x80\x80\xF0\x90\x80\x80\xF4\x8F\xBF\xBF\", 1]}";
+        auto root = nanojsoncpp::parse(json_input, descriptors, on_error);
+        REQUIRE(root);
+        CHECK(root->get("ascii")->is_ascii());
+        CHECK_FALSE(root->get("caf\xC3\xA9")->is_ascii());
+        CHECK_EQ(root->get("caf\xC3\xA9")->get(), "\xE2\x82\xAC \xF0\x9F\x98\x80");
+        CHECK_FALSE(root->get("limits")->get(0u)->is_ascii());
+        CHECK_FALSE(root->get("limits")->get(1u)->is_ascii());
+        CHECK_FALSE(root->get("limits")->is_ascii());
+
+#ifdef NANOJSONCPP_USE_UTF8_VALIDATION
+        // Invalid sequences are reported at their first byte, in names and in values
+        const std::vector<std::pair<std::string, nanojsoncpp::json_size_t>> invalid_inputs = {
+            {"[\"abc\x80\"]", 5u},                         // Lone continuation byte
+            {"[\"\xC0\xAF\"]", 2u},                        // Overlong 2 bytes sequence
+            {"[\"ab\xE0\x9F\xBF\"]", 4u},                  // Overlong 3 bytes sequence
+            {"[\"\xED\xA0\x80\"]", 2u},                    // Surrogate
+            {"[\"\xF0\x8F\xBF\xBF\"]", 2u},                // Overlong 4 bytes sequence
+            {"[\"\xF4\x90\x80\x80\"]", 2u},                // Above U+10FFFF
+            {"[\"\xF5\x80\x80\x80\"]", 2u},                // Invalid lead byte
+            {"[\"\xE2\x82\"]", 2u},                        // Truncated sequence
+            {"[\"0123456789abcdef0123456789\xC3\"]", 28u}, // Truncated sequence after a SIMD block
+            {"{\"key\": 1, \"k\xFF\": 2}", 13u}};          // Invalid member name
+        for (const auto& [invalid_input, expected_index] : invalid_inputs)
+        {
+            CHECK_FALSE(nanojsoncpp::parse(invalid_input, descriptors, on_error));
+            CHECK_EQ(error_index, expected_index);
+            CHECK_EQ(error, nanojsoncpp::json_parse_error::invalid_utf8_char);
+            CHECK_FALSE(nanojsoncpp::validate(invalid_input));
+        }
+#endif // NANOJSONCPP_USE_UTF8_VALIDATION
+    }
+
+    TEST_CASE("Validation")
+    {
+        const std::vector<std::string> valid_inputs = {"[]",
+                                                       " { } ",
+                                                       R"({"a": 1, "b": [true, null, "x\n\"y\""], "c": {"d": {}}})",
+                                                       "[[[[]], []], [[[1, 2.5]]]]",
+                                                       R"([{"a": [1]}, {"b": [2, [3]]}, -4])"};
+        for (const auto& json_input : valid_inputs)
+        {
+            CHECK(nanojsoncpp::validate(json_input));
+        }
+
+        // Errors are reported at the same index as parse()
+        const std::vector<std::string> invalid_inputs = {"",
+                                                         "1",
+                                                         "[1, 2",
+                                                         "[1] 2",
+                                                         "{]",
+                                                         "[1, ]",
+                                                         R"({"a" 1})",
+                                                         R"({"a": [1, 2})",
+                                                         R"({"a": "b\x"})",
+                                                         R"(["a\u00"])",
+                                                         "[tru]",
+                                                         "[-]"};
+        for (const auto& json_input : invalid_inputs)
+        {
+            nanojsoncpp::json_size_t                  parse_index = 0u;
+            nanojsoncpp::json_parse_error             parse_error = nanojsoncpp::json_parse_error::no_error;
+            std::vector<nanojsoncpp::json_value_desc> descriptors(20u);
+            CHECK_FALSE(nanojsoncpp::parse(json_input,
+                                           descriptors,
+                                           [&](nanojsoncpp::json_size_t index, nanojsoncpp::json_parse_error error)
+                                           {
+                                               parse_index = index;
+                                               parse_error = error;
+                                           }));
+
+            nanojsoncpp::json_size_t      error_index = 0u;
+            nanojsoncpp::json_parse_error error       = nanojsoncpp::json_parse_error::no_error;
+            CHECK_FALSE(nanojsoncpp::validate(json_input,
+                                              nanojsoncpp::MAX_NESTING_LEVEL,
+                                              [&](nanojsoncpp::json_size_t _error_index, nanojsoncpp::json_parse_error _error)
+                                              {
+                                                  error_index = _error_index;
+                                                  error       = _error;
+                                              }));
+            CHECK_EQ(error_index, parse_index);
+            CHECK_EQ(error, parse_error);
+        }
+
+        // Maximum depth
+        const std::string                  nested  = R"({"a": [1, {"b": [2]}], "c": {}})";
+        nanojsoncpp::json_size_t           index   = 0u;
+        nanojsoncpp::json_parse_error      error   = nanojsoncpp::json_parse_error::no_error;
+        nanojsoncpp::parse_error_handler_t handler = [&](nanojsoncpp::json_size_t _index, nanojsoncpp::json_parse_error _error)
+        {
+            index = _index;
+            error = _error;
+        };
+        CHECK(nanojsoncpp::validate(nested, 4u, handler));
+        CHECK_FALSE(nanojsoncpp::validate(nested, 3u, handler));
+        CHECK_EQ(index, 16u);
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::max_nesting_level);
+        CHECK_FALSE(nanojsoncpp::validate(nested, 2u, handler));
+        CHECK_EQ(index, 10u);
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::max_nesting_level);
+        CHECK_FALSE(nanojsoncpp::validate(nested, 1u, nanojsoncpp::no_error_handler()));
+        CHECK_FALSE(nanojsoncpp::validate(nested, 0u));
+        CHECK(nanojsoncpp::validate("[1, {}, []]", 2u));
+
+        // Nesting up to the maximum nesting level
+        std::string deep(nanojsoncpp::MAX_NESTING_LEVEL, '[');
+        deep += std::string(nanojsoncpp::MAX_NESTING_LEVEL, ']');
+        CHECK(nanojsoncpp::validate(deep));
+        CHECK_FALSE(nanojsoncpp::validate("[" + deep + "]"));
+    }
+
+    TEST_CASE("Path filtered parsing")
+    {
+        std::string json_input = R"({ "vendor": { "name": "acme", "info": [ 1, 2, { "id": 3 } ] },
+                                      "device": { "name": "sensor", "id": 1234, "config": { "period": 10, "unit": "s" } },
+                                      "readings": [ { "time": 1, "value": 21.5 }, { "time": 2 }, { "time": 3, "value": [22, 23] } ],
+                                      "status": "ok" })";
+
+        const std::array<std::string_view, 4u> paths = {"/device/id", "/readings/*/value", "/device/config", "/status"};
+        nanojsoncpp::json_path_filter          filter(paths);
+        REQUIRE(filter.is_valid());
+
+        // Only the selected values and their parents are stored : root, device, id, config (+2), readings (+3 objects, 1 + 2 + 1 values), status
+        std::array<nanojsoncpp::json_value_desc, 16u> descriptors;
+        auto                                          root = nanojsoncpp::parse(json_input, descriptors, filter);
+        REQUIRE(root);
+        CHECK_EQ(root->size(), 3u);
+        CHECK_FALSE(root->get("vendor"));
+        CHECK_EQ(root->get("status")->get(), "ok");
+
+        auto device = root->get("device");
+        REQUIRE(device);
+        CHECK_EQ(device->size(), 2u);
+        CHECK_FALSE(device->get("name"));
+        CHECK_EQ(device->get("id")->get<int>(), 1234);
+        CHECK_EQ(device->get("config")->size(), 2u);
+        CHECK_EQ(device->get("config")->get("unit")->get(), "s");
+
+        auto readings = root->get("readings");
+        REQUIRE(readings);
+        CHECK_EQ(readings->size(), 3u);
+        CHECK_EQ(readings->get(0u)->size(), 1u);
+        CHECK_EQ(readings->get(0u)->get("value")->get<double>(), 21.5);
+        CHECK_FALSE(readings->get(0u)->get("time"));
+        CHECK_EQ(readings->get(1u)->size(), 0u);
+        CHECK_EQ(readings->get(2u)->get("value")->get(1u)->get<int>(), 23);
+
+        // The descriptors pool can be smaller than the whole json string needs
+        CHECK_FALSE(nanojsoncpp::parse(json_input, descriptors));
+        std::array<nanojsoncpp::json_value_desc, 15u> small_descriptors;
+        nanojsoncpp::json_parse_error                 error = nanojsoncpp::json_parse_error::no_error;
+        CHECK_FALSE(nanojsoncpp::parse(json_input,
+                                       small_descriptors,
+                                       filter,
+                                       [&](nanojsoncpp::json_size_t, nanojsoncpp::json_parse_error _error) { error = _error; }));
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::not_enough_memory);
+
+        // Array indexes
+        const std::array<std::string_view, 2u> index_paths = {"/readings/2/value/0", "/vendor/info/1"};
+        nanojsoncpp::json_path_filter          index_filter(index_paths);
+        auto                                   root2 = nanojsoncpp::parse(json_input, descriptors, index_filter);
+        REQUIRE(root2);
+        CHECK_EQ(root2->get("vendor")->get("info")->size(), 1u);
+        CHECK_EQ(root2->get("vendor")->get("info")->get(0u)->get<int>(), 2);
+        CHECK_EQ(root2->get("readings")->size(), 1u);
+        CHECK_EQ(root2->get("readings")->get(0u)->get("value")->get(0u)->get<int>(), 22);
+        CHECK_EQ(root2->get("readings")->get(0u)->get("value")->size(), 1u);
+
+        // Array indexes up to the maximum json_size_t value, without leading zeros
+        std::string large_array = R"({ "a": [)";
+        for (size_t i = 0u; i < 12000u; i++)
+        {
+            large_array += ((i == 10001u) ? "7," : "0,");
+        }
+        large_array.back() = ']';
+        large_array += " }";
+        const std::array<std::string_view, 1u> large_index_paths = {"/a/10001"};
+        auto                                   root3 = nanojsoncpp::parse(large_array, descriptors, nanojsoncpp::json_path_filter(large_index_paths));
+        REQUIRE(root3);
+        CHECK_EQ(root3->get("a")->size(), 1u);
+        CHECK_EQ(root3->get("a")->get(0u)->get<int>(), 7);
+        const std::array<std::string_view, 4u> not_index_paths = {"/a/010001", "/a/65536", "/a/99999999999999999999999", "/a/1a"};
+        auto                                   root4 = nanojsoncpp::parse(large_array, descriptors, nanojsoncpp::json_path_filter(not_index_paths));
+        REQUIRE(root4);
+        CHECK_EQ(root4->get("a")->size(), 0u);
+        const std::array<std::string_view, 1u> leading_zero_paths = {"/vendor/info/01"};
+        auto                                   root5 = nanojsoncpp::parse(json_input, descriptors, nanojsoncpp::json_path_filter(leading_zero_paths));
+        REQUIRE(root5);
+        CHECK_EQ(root5->get("vendor")->get("info")->size(), 0u);
+
+        // The values which are not stored are still checked
+        error = nanojsoncpp::json_parse_error::no_error;
+        CHECK_FALSE(nanojsoncpp::parse(R"({ "device": { "id": 1 }, "other": [1, 2,] })",
+                                       descriptors,
+                                       filter,
+                                       [&](nanojsoncpp::json_size_t, nanojsoncpp::json_parse_error _error) { error = _error; }));
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::unexpected_char);
+
+        // Invalid filters
+        const std::array<std::string_view, 1u> invalid_paths1 = {"device/id"};
+        const std::array<std::string_view, 1u> invalid_paths2 = {"/device//id"};
+        const std::array<std::string_view, 1u> invalid_paths3 = {"/"};
+        const std::array<std::string_view, 1u> invalid_paths4 = {"/1/2/3/4/5/6/7/8/9/10/11/12/13/14/15/16/17"};
+        CHECK_FALSE(nanojsoncpp::json_path_filter(invalid_paths1).is_valid());
+        CHECK_FALSE(nanojsoncpp::json_path_filter(invalid_paths2).is_valid());
+        CHECK_FALSE(nanojsoncpp::json_path_filter(invalid_paths3).is_valid());
+        CHECK_FALSE(nanojsoncpp::json_path_filter(invalid_paths4).is_valid());
+        CHECK_FALSE(nanojsoncpp::parse(json_input, descriptors, nanojsoncpp::json_path_filter(invalid_paths1)));
+        std::vector<std::string_view> too_many_paths(nanojsoncpp::MAX_FILTER_PATHS + 1u, "/a");
+        CHECK_FALSE(nanojsoncpp::json_path_filter(too_many_paths).is_valid());
+    }
+
+    TEST_CASE("Depth limited parsing")
+    {
+        std::string json_input = R"({ "type": "telemetry", "route": [1, 2],
+                                      "payload": { "sensors": [ { "id": 1, "values": [1, 2, 3] }, { "id": 2, "name": "]}" } ], "count": 2 },
+                                      "empty": {} })";
+
+        // Only the root members are expanded
+        std::array<nanojsoncpp::json_value_desc, 6u> descriptors;
+        auto                                         root = nanojsoncpp::parse(json_input, descriptors, 1u);
+        REQUIRE(root);
+        CHECK_EQ(root->size(), 4u);
+        CHECK_EQ(root->get("type")->get(), "telemetry");
+
+        auto route = root->get("route");
+        REQUIRE(route);
+        CHECK(route->is_unexpanded());
+        CHECK_FALSE(route->is_array());
+        CHECK_EQ(route->get(), "[1, 2]");
+        CHECK_EQ(route->size(), 6u);
+        CHECK_FALSE(route->get(0u));
+
+        auto payload = root->get("payload");
+        REQUIRE(payload);
+        CHECK(payload->is_unexpanded());
+        CHECK_EQ(payload->get(), R"({ "sensors": [ { "id": 1, "values": [1, 2, 3] }, { "id": 2, "name": "]}" } ], "count": 2 })");
+        CHECK_FALSE(payload->get("count"));
+        size_t count = 0u;
+        for ([[maybe_unused]] const auto& value : payload.value())
+        {
+            count++;
+        }
+        CHECK_EQ(count, 0u);
+        CHECK_EQ(root->get("empty")->get(), "{}");
+
+        // Expand the payload on demand, up to 2 levels
+        std::array<nanojsoncpp::json_value_desc, 10u> payload_descriptors;
+        auto                                          expanded = payload->expand(payload_descriptors, 2u);
+        REQUIRE(expanded);
+        CHECK(expanded->is_object());
+        CHECK_EQ(expanded->size(), 2u);
+        CHECK_EQ(expanded->get("count")->get<int>(), 2);
+        auto sensors = expanded->get("sensors");
+        REQUIRE(sensors);
+        CHECK_EQ(sensors->size(), 2u);
+        CHECK(sensors->get(0u)->is_unexpanded());
+        CHECK_EQ(sensors->get(1u)->get(), R"({ "id": 2, "name": "]}" })");
+
+        // Expand a nested value completely
+        std::array<nanojsoncpp::json_value_desc, 10u> sensor_descriptors;
+        auto                                          sensor = sensors->get(0u)->expand(sensor_descriptors);
+        REQUIRE(sensor);
+        CHECK_EQ(sensor->get("id")->get<int>(), 1);
+        CHECK_EQ(sensor->get("values")->get(2u)->get<int>(), 3);
+        CHECK_FALSE(sensor->get("values")->is_unexpanded());
+        CHECK_FALSE(sensor->get("values")->expand(sensor_descriptors));
+        CHECK_FALSE(sensor->expand(sensor_descriptors));
+
+        // Not enough descriptors to expand
+        std::array<nanojsoncpp::json_value_desc, 4u> small_descriptors;
+        CHECK_FALSE(sensors->get(0u)->expand(small_descriptors));
+
+        // Unexpanded values are still checked
+        nanojsoncpp::json_size_t      error_index = 0u;
+        nanojsoncpp::json_parse_error error       = nanojsoncpp::json_parse_error::no_error;
+        CHECK_FALSE(nanojsoncpp::parse(R"({ "a": 1, "b": { "c": [1, 2,] } })",
+                                       descriptors,
+                                       1u,
+                                       [&](nanojsoncpp::json_size_t _error_index, nanojsoncpp::json_parse_error _error)
+                                       {
+                                           error_index = _error_index;
+                                           error       = _error;
+                                       }));
+        CHECK_EQ(error_index, 28u);
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::unexpected_char);
+
+        // Unlimited depth is a full parsing
+        std::array<nanojsoncpp::json_value_desc, 30u> all_descriptors;
+        auto root2 = nanojsoncpp::parse(json_input, all_descriptors, nanojsoncpp::MAX_NESTING_LEVEL, nanojsoncpp::no_error_handler());
+        REQUIRE(root2);
+        CHECK_EQ(root2->get("payload")->get("sensors")->get(1u)->get("name")->get(), "]}");
+
+        // Depth limited array root
+        auto root3 = nanojsoncpp::parse(R"([[1, [2]], {"a": [3]}, 4])", payload_descriptors, 2u);
+        REQUIRE(root3);
+        CHECK_EQ(root3->size(), 3u);
+        CHECK(root3->get(0u)->is_array());
+        CHECK_EQ(root3->get(0u)->get(1u)->get(), "[2]");
+        CHECK_EQ(root3->get(1u)->get("a")->get(), "[3]");
+        CHECK_EQ(root3->get(2u)->get<int>(), 4);
+    }
+
+    TEST_CASE("Multiple documents parsing")
+    {
+        std::string json_input = "{\"id\": 1, \"tags\": [\"a\"]}\n"
+                                 "\r\n"
+                                 "  [1, 2, 3]\n"
+                                 "{\"id\": 3}{\"id\": 4}[]\n";
+
+        // Reused descriptors
+        std::array<nanojsoncpp::json_value_desc, 5u> descriptors;
+        std::vector<size_t>                          offsets;
+        std::vector<size_t>                          sizes;
+        std::vector<size_t>                          counts;
+        auto                                         documents = nanojsoncpp::parse_many(json_input, descriptors);
+        for (const auto& document : documents)
+        {
+            offsets.push_back(document.offset);
+            sizes.push_back(document.size);
+            counts.push_back(document.root.size());
+            CHECK_EQ(json_input[document.offset], (document.root.is_object() ? '{' : '['));
+            CHECK_EQ(json_input[document.offset + document.size - 1u], (document.root.is_object() ? '}' : ']'));
+            if (document.root.is_object())
+            {
+                CHECK_EQ(document.root.get("id")->get<size_t>(), counts.size());
+            }
+        }
+        CHECK(documents.is_successful());
+        CHECK_EQ(documents.get_offset(), json_input.size());
+        CHECK_EQ(offsets, std::vector<size_t>{0u, 29u, 39u, 48u, 57u});
+        CHECK_EQ(sizes, std::vector<size_t>{24u, 9u, 9u, 9u, 2u});
+        CHECK_EQ(counts, std::vector<size_t>{2u, 3u, 1u, 1u, 0u});
+        CHECK_FALSE(documents.next());
+
+        // Appended documents : all the documents remain valid
+        std::array<nanojsoncpp::json_value_desc, 14u> shared_descriptors;
+        std::vector<nanojsoncpp::json_value>          roots;
+        auto appended = nanojsoncpp::parse_many(json_input, shared_descriptors, nanojsoncpp::json_documents_storage::append);
+        for (auto document = appended.next(); document; document = appended.next())
+        {
+            roots.push_back(document->root);
+        }
+        CHECK(appended.is_successful());
+        REQUIRE_EQ(roots.size(), 5u);
+        CHECK_EQ(roots[0u].size(), 2u);
+        CHECK_EQ(roots[0u].get("tags")->get(0u)->get(), "a");
+        std::vector<int> elements;
+        for (const auto& element : roots[1u])
+        {
+            elements.push_back(element.get<int>());
+        }
+        CHECK_EQ(elements, std::vector<int>{1, 2, 3});
+        CHECK_EQ(roots[2u].get("id")->get<int>(), 3);
+        CHECK_EQ(roots[3u].get("id")->get<int>(), 4);
+        CHECK_FALSE(roots[3u].get("tags"));
+        CHECK_EQ(roots[4u].size(), 0u);
+
+        // Not enough descriptors for the last document
+        std::array<nanojsoncpp::json_value_desc, 13u> small_descriptors;
+        nanojsoncpp::json_size_t                      error_index = 0u;
+        nanojsoncpp::json_parse_error                 error       = nanojsoncpp::json_parse_error::no_error;
+        auto not_enough = nanojsoncpp::parse_many(json_input,
+                                                  small_descriptors,
+                                                  nanojsoncpp::json_documents_storage::append,
+                                                  [&](nanojsoncpp::json_size_t _error_index, nanojsoncpp::json_parse_error _error)
+                                                  {
+                                                      error_index = _error_index;
+                                                      error       = _error;
+                                                  });
+        size_t count = 0u;
+        for ([[maybe_unused]] const auto& document : not_enough)
+        {
+            count++;
+        }
+        CHECK_EQ(count, 4u);
+        CHECK_FALSE(not_enough.is_successful());
+        CHECK_EQ(not_enough.get_offset(), 57u);
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::not_enough_memory);
+
+        // Invalid documents : the error index is relative to the invalid document
+        auto invalid = nanojsoncpp::parse_many(R"({"a": 1} {"b": tru} {"c": 3})",
+                                               descriptors,
+                                               nanojsoncpp::json_documents_storage::reuse,
+                                               [&](nanojsoncpp::json_size_t _error_index, nanojsoncpp::json_parse_error _error)
+                                               {
+                                                   error_index = _error_index;
+                                                   error       = _error;
+                                               });
+        CHECK(invalid.next());
+        CHECK_FALSE(invalid.next());
+        CHECK_FALSE(invalid.next());
+        CHECK_FALSE(invalid.is_successful());
+        CHECK_EQ(invalid.get_offset(), 9u);
+        CHECK_EQ(error_index, 6u);
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::invalid_value);
+
+        auto not_json = nanojsoncpp::parse_many("[1]\n2\n", descriptors, nanojsoncpp::json_documents_storage::reuse);
+        CHECK(not_json.next());
+        CHECK_FALSE(not_json.next());
+        CHECK_FALSE(not_json.is_successful());
+        CHECK_EQ(not_json.get_offset(), 4u);
+
+        auto unterminated = nanojsoncpp::parse_many("[1]\n[2", descriptors);
+        CHECK(unterminated.next());
+        CHECK_FALSE(unterminated.next());
+        CHECK_FALSE(unterminated.is_successful());
+
+        // Empty and blank strings contain no document
+        auto empty = nanojsoncpp::parse_many("", descriptors);
+        CHECK_FALSE(empty.next());
+        CHECK(empty.is_successful());
+        auto blank = nanojsoncpp::parse_many(" \n\t\r\n", descriptors);
+        CHECK_FALSE(blank.next());
+        CHECK(blank.is_successful());
+        CHECK_EQ(blank.get_offset(), 5u);
+    }
+
     TEST_CASE("Other parse errors")
     {
         std::array<nanojsoncpp::json_value_desc, 5u> descriptors;
@@ -1335,6 +2843,20 @@ TEST_SUITE("json parsing test suite")
         CHECK_EQ(error_index, 0u);
         CHECK_EQ(error, nanojsoncpp::json_parse_error::not_enough_memory);
 
+        error_index = 10u;
+        error       = nanojsoncpp::json_parse_error::no_error;
+        std::array<nanojsoncpp::json_value_desc, 1u> single_descriptor;
+        auto                                         root1b = nanojsoncpp::parse("[]",
+                                         single_descriptor,
+                                         [&](nanojsoncpp::json_size_t _error_index, nanojsoncpp::json_parse_error _error)
+                                         {
+                                             error_index = _error_index;
+                                             error       = _error;
+                                         });
+        CHECK_FALSE(root1b);
+        CHECK_EQ(error_index, 0u);
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::not_enough_memory);
+
         error_index = 0u;
         error       = nanojsoncpp::json_parse_error::no_error;
         auto root2  = nanojsoncpp::parse(json_input_obj1,
@@ -1489,6 +3011,51 @@ TEST_SUITE("json parsing test suite")
         CHECK_FALSE(root11);
         CHECK_EQ(error_index, 26u);
         CHECK_EQ(error, nanojsoncpp::json_parse_error::unexpected_end_of_json_string);
+
+        std::string json_input_obj9 = R"([ ]])";
+
+        error_index = 0u;
+        error       = nanojsoncpp::json_parse_error::no_error;
+        auto root12 = nanojsoncpp::parse(json_input_obj9,
+                                         descriptors,
+                                         [&](nanojsoncpp::json_size_t _error_index, nanojsoncpp::json_parse_error _error)
+                                         {
+                                             error_index = _error_index;
+                                             error       = _error;
+                                         });
+        CHECK_FALSE(root12);
+        CHECK_EQ(error_index, 3u);
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::trailing_chars);
+
+        std::string json_input_obj10 = R"({"truncated": "value")";
+
+        error_index = 0u;
+        error       = nanojsoncpp::json_parse_error::no_error;
+        auto root13 = nanojsoncpp::parse(json_input_obj10,
+                                         descriptors,
+                                         [&](nanojsoncpp::json_size_t _error_index, nanojsoncpp::json_parse_error _error)
+                                         {
+                                             error_index = _error_index;
+                                             error       = _error;
+                                         });
+        CHECK_FALSE(root13);
+        CHECK_EQ(error_index, 22u);
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::unexpected_end_of_json_string);
+
+        std::string json_input_arr1 = R"([[2, 3])";
+
+        error_index = 0u;
+        error       = nanojsoncpp::json_parse_error::no_error;
+        auto root14 = nanojsoncpp::parse(json_input_arr1,
+                                         descriptors,
+                                         [&](nanojsoncpp::json_size_t _error_index, nanojsoncpp::json_parse_error _error)
+                                         {
+                                             error_index = _error_index;
+                                             error       = _error;
+                                         });
+        CHECK_FALSE(root14);
+        CHECK_EQ(error_index, 8u);
+        CHECK_EQ(error, nanojsoncpp::json_parse_error::unexpected_end_of_json_string);
     }
 }
 
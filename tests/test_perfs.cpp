@@ -7,6 +7,9 @@
 #include <doctest.h>
 
 #include <nanojsoncpp/nanojsoncpp.h>
+#ifdef NANOJSONCPP_BUILD_PARALLEL
+#include <nanojsoncpp/nanojsoncpp_parallel.h>
+#endif // NANOJSONCPP_BUILD_PARALLEL
 
 #include <nlohmann/json.hpp>
 
@@ -16,11 +19,31 @@
 #include <filesystem>
 #include <fstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 using namespace std::string_literals;
 using namespace std::chrono_literals;
 
+/** @brief Parser core configuration used for the nanojsoncpp measurements */
+static const char* const NANOJSONCPP_PARSER_CORE =
+#ifdef NANOJSONCPP_USE_CHAR_CLASS_TABLE
+    "char class table"
+#else
+    "char comparisons"
+#endif // NANOJSONCPP_USE_CHAR_CLASS_TABLE
+#ifdef NANOJSONCPP_USE_SIMD_SCAN
+    " + simd scan";
+#else
+    "";
+#endif // NANOJSONCPP_USE_SIMD_SCAN
+
+/** @brief Compute a parsing throughput in MB/s */
+static double get_throughput(size_t size, int iterations, std::chrono::microseconds duration)
+{
+    return ((static_cast<double>(size) * static_cast<double>(iterations)) / static_cast<double>(duration.count()));
+}
+
 TEST_SUITE("Performance tests")
 {
     TEST_CASE("Large json file")
@@ -61,7 +84,115 @@ TEST_SUITE("Performance tests")
             const auto stop = std::chrono::high_resolution_clock::now();
 
             const auto test_duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
-            std::cout << "[nanojsoncpp] : " << test_duration.count() << "µs" << std::endl;
+            std::cout << "[nanojsoncpp - " << NANOJSONCPP_PARSER_CORE << "] : " << test_duration.count() << "µs ("
+                      << get_throughput(input_json_str.size(), 1000, test_duration) << " MB/s)" << std::endl;
+        }
+
+        SUBCASE("nanojsoncpp - count only")
+        {
+            const auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < 1000; i++)
+            {
+                auto count = nanojsoncpp::parse_count(input_json_str, nanojsoncpp::no_error_handler());
+                if (!count)
+                {
+                    CHECK(false);
+                }
+            }
+            const auto stop = std::chrono::high_resolution_clock::now();
+
+            const auto test_duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
+            std::cout << "[nanojsoncpp - count - " << NANOJSONCPP_PARSER_CORE << "] : " << test_duration.count() << "µs ("
+                      << get_throughput(input_json_str.size(), 1000, test_duration) << " MB/s)" << std::endl;
+        }
+
+        SUBCASE("nanojsoncpp - validate only")
+        {
+            const auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < 1000; i++)
+            {
+                if (!nanojsoncpp::validate(input_json_str, nanojsoncpp::MAX_NESTING_LEVEL, nanojsoncpp::no_error_handler()))
+                {
+                    CHECK(false);
+                }
+            }
+            const auto stop = std::chrono::high_resolution_clock::now();
+
+            const auto test_duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
+            std::cout << "[nanojsoncpp - validate - " << NANOJSONCPP_PARSER_CORE << "] : " << test_duration.count() << "µs ("
+                      << get_throughput(input_json_str.size(), 1000, test_duration) << " MB/s)" << std::endl;
+        }
+
+        SUBCASE("nanojsoncpp - events without descriptors")
+        {
+            // Count the values and sum the integers without storing them
+            struct integer_sum : nanojsoncpp::json_visitor
+            {
+                size_t                  count = 0u;
+                nanojsoncpp::json_int_t sum   = 0;
+                void                    on_integer(nanojsoncpp::json_int_t value)
+                {
+                    count++;
+                    sum += value;
+                }
+            };
+            integer_sum visitor;
+
+            const auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < 1000; i++)
+            {
+                if (!nanojsoncpp::parse_events(input_json_str, visitor))
+                {
+                    CHECK(false);
+                }
+            }
+            const auto stop = std::chrono::high_resolution_clock::now();
+
+            const auto test_duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
+            std::cout << "[nanojsoncpp - events - " << NANOJSONCPP_PARSER_CORE << "] : " << test_duration.count() << "µs ("
+                      << get_throughput(input_json_str.size(), 1000, test_duration) << " MB/s, " << visitor.count << " integers)"
+                      << std::endl;
+        }
+
+        SUBCASE("nanojsoncpp - on-demand access to the last element")
+        {
+            const auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < 1000; i++)
+            {
+                auto root = nanojsoncpp::parse_on_demand(input_json_str);
+                auto last = root->get(29u);
+                if (!last || !last->get("age"))
+                {
+                    CHECK(false);
+                }
+            }
+            const auto stop = std::chrono::high_resolution_clock::now();
+
+            const auto test_duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
+            std::cout << "[nanojsoncpp - on-demand - " << NANOJSONCPP_PARSER_CORE << "] : " << test_duration.count() << "µs ("
+                      << get_throughput(input_json_str.size(), 1000, test_duration) << " MB/s)" << std::endl;
+        }
+
+        SUBCASE("nanojsoncpp - path filtered")
+        {
+            const std::array<std::string_view, 2u>    paths = {"/*/name", "/*/friends/*/id"};
+            nanojsoncpp::json_path_filter             filter(paths);
+            std::vector<nanojsoncpp::json_value_desc> descriptors(1000u);
+
+            const auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < 1000; i++)
+            {
+                auto root = nanojsoncpp::parse(input_json_str, descriptors, filter, nanojsoncpp::no_error_handler());
+                if (!root)
+                {
+                    CHECK(false);
+                }
+            }
+            const auto stop = std::chrono::high_resolution_clock::now();
+
+            const auto test_duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
+            std::cout << "[nanojsoncpp - path filtered - " << NANOJSONCPP_PARSER_CORE << "] : " << test_duration.count() << "µs ("
+                      << get_throughput(input_json_str.size(), 1000, test_duration) << " MB/s)" << std::endl;
         }
 
         SUBCASE("nlohmann::json - parse only")
@@ -78,7 +209,8 @@ TEST_SUITE("Performance tests")
             const auto stop = std::chrono::high_resolution_clock::now();
 
             const auto test_duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
-            std::cout << "[nlohmann::json] : " << test_duration.count() << "µs" << std::endl;
+            std::cout << "[nlohmann::json] : " << test_duration.count() << "µs (" << get_throughput(input_json_str.size(), 1000, test_duration)
+                      << " MB/s)" << std::endl;
         }
 
         SUBCASE("tiny-json - parse only")
@@ -104,7 +236,606 @@ TEST_SUITE("Performance tests")
             const auto stop = std::chrono::high_resolution_clock::now();
 
             const auto test_duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
-            std::cout << "[tiny-json] : " << test_duration.count() << "µs" << std::endl;
+            std::cout << "[tiny-json] : " << test_duration.count() << "µs (" << get_throughput(input_json_str.size(), 1000, test_duration)
+                      << " MB/s)" << std::endl;
+        }
+    }
+
+    TEST_CASE("Large array of nested objects")
+    {
+        // Array of deeply nested objects : closing an object must not depend on the size of its content
+        std::string input_json_str = "[";
+        for (int i = 0; i < 80; i++)
+        {
+            if (i != 0)
+            {
+                input_json_str += ",";
+            }
+            for (int level = 0; level < 32; level++)
+            {
+                input_json_str += "{\"id\":" + std::to_string(level) + ",\"child\":";
+            }
+            input_json_str += "[1,2,3]";
+            input_json_str.append(32u, '}');
+        }
+        input_json_str += "]";
+
+        SUBCASE("nanojsoncpp - parse only")
+        {
+            std::vector<nanojsoncpp::json_value_desc> descriptors(1000000);
+
+            const auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < 1000; i++)
+            {
+                auto root = nanojsoncpp::parse(input_json_str, descriptors);
+                if (!root)
+                {
+                    CHECK(false);
+                }
+            }
+            const auto stop = std::chrono::high_resolution_clock::now();
+
+            const auto test_duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
+            std::cout << "[nanojsoncpp - " << NANOJSONCPP_PARSER_CORE << "] : " << test_duration.count() << "µs ("
+                      << get_throughput(input_json_str.size(), 1000, test_duration) << " MB/s)" << std::endl;
+        }
+
+        SUBCASE("nanojsoncpp - iterate top level")
+        {
+            std::vector<nanojsoncpp::json_value_desc> descriptors(1000000);
+
+            auto root = nanojsoncpp::parse(input_json_str, descriptors);
+            REQUIRE(root);
+
+            size_t     count = 0u;
+            const auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < 1000; i++)
+            {
+                for (const auto& value : root.value())
+                {
+                    count += value.size();
+                }
+            }
+            const auto stop = std::chrono::high_resolution_clock::now();
+            CHECK_EQ(count, 1000u * 80u * 2u);
+
+            const auto test_duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
+            std::cout << "[nanojsoncpp - iterate"
+#ifdef NANOJSONCPP_USE_SUBTREE_SIZE
+                      << " with subtree size"
+#endif // NANOJSONCPP_USE_SUBTREE_SIZE
+                      << "] : " << test_duration.count() << "µs" << std::endl;
+        }
+
+        SUBCASE("nlohmann::json - parse only")
+        {
+            const auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < 1000; i++)
+            {
+                auto root = nlohmann::json::parse(input_json_str);
+                if (root.is_null())
+                {
+                    CHECK(false);
+                }
+            }
+            const auto stop = std::chrono::high_resolution_clock::now();
+
+            const auto test_duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
+            std::cout << "[nlohmann::json] : " << test_duration.count() << "µs (" << get_throughput(input_json_str.size(), 1000, test_duration)
+                      << " MB/s)" << std::endl;
+        }
+    }
+
+    TEST_CASE("Large object lookups")
+    {
+        // Object with several hundreds of members
+        std::string input_json_str = "{";
+        for (int i = 0; i < 500; i++)
+        {
+            if (i != 0)
+            {
+                input_json_str += ",";
+            }
+            input_json_str += "\"member_" + std::to_string(i) + "\":" + std::to_string(i);
+        }
+        input_json_str += "}";
+
+        std::vector<nanojsoncpp::json_value_desc> descriptors(1000u);
+        auto                                      root = nanojsoncpp::parse(input_json_str, descriptors);
+        REQUIRE(root);
+
+        std::vector<std::string> names;
+        for (int i = 0; i < 500; i++)
+        {
+            names.push_back("member_" + std::to_string((i * 7) % 500));
+        }
+
+        SUBCASE("nanojsoncpp - linear lookup")
+        {
+            int        sum   = 0;
+            const auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < 100; i++)
+            {
+                for (const auto& name : names)
+                {
+                    sum += root->get(name)->get<int>();
+                }
+            }
+            const auto stop = std::chrono::high_resolution_clock::now();
+            CHECK_EQ(sum, 100 * 499 * 500 / 2);
+
+            const auto test_duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
+            std::cout << "[nanojsoncpp - linear lookup] : " << test_duration.count() << "µs" << std::endl;
+        }
+
+        SUBCASE("nanojsoncpp - hash index lookup")
+        {
+            std::vector<nanojsoncpp::json_size_t> storage(nanojsoncpp::json_object_index::get_storage_size(root->size()));
+
+            int        sum   = 0;
+            const auto start = std::chrono::high_resolution_clock::now();
+            auto       index = nanojsoncpp::json_object_index::build(root.value(), storage);
+            REQUIRE(index);
+            for (int i = 0; i < 100; i++)
+            {
+                for (const auto& name : names)
+                {
+                    sum += index->get(name)->get<int>();
+                }
+            }
+            const auto stop = std::chrono::high_resolution_clock::now();
+            CHECK_EQ(sum, 100 * 499 * 500 / 2);
+
+            const auto test_duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
+            std::cout << "[nanojsoncpp - hash index lookup] : " << test_duration.count() << "µs" << std::endl;
+        }
+    }
+
+#ifdef NANOJSONCPP_BUILD_PARALLEL
+    TEST_CASE("Repeated numeric reads")
+    {
+        // Numbers read many times after a single parsing
+        std::string input_json_str = "[";
+        for (int i = 0; i < 1000; i++)
+        {
+            if (i != 0)
+            {
+                input_json_str += ",";
+            }
+            input_json_str += "{\"t\":" + std::to_string(i) + ".25e-1,\"v\":" + std::to_string(i * 7919) + "}";
+        }
+        input_json_str += "]";
+
+        std::vector<nanojsoncpp::json_value_desc> descriptors(4000u);
+        std::vector<nanojsoncpp::json_number>     numbers(4000u);
+
+        SUBCASE("nanojsoncpp - converted at each read")
+        {
+            auto root = nanojsoncpp::parse(input_json_str, descriptors);
+            REQUIRE(root);
+
+            double     sum   = 0.;
+            const auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < 100; i++)
+            {
+                for (const auto& record : root.value())
+                {
+                    for (const auto& field : record)
+                    {
+                        sum += field.get<double>();
+                    }
+                }
+            }
+            const auto stop = std::chrono::high_resolution_clock::now();
+            CHECK_GT(sum, 0.);
+
+            const auto test_duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
+            std::cout << "[nanojsoncpp - converted at each read] : " << test_duration.count() << "µs" << std::endl;
+        }
+
+        SUBCASE("nanojsoncpp - converted during parsing")
+        {
+            const auto start = std::chrono::high_resolution_clock::now();
+            auto       root  = nanojsoncpp::parse(input_json_str, descriptors, numbers);
+            REQUIRE(root);
+
+            double sum = 0.;
+            for (int i = 0; i < 100; i++)
+            {
+                for (const auto& record : root.value())
+                {
+                    for (const auto& field : record)
+                    {
+                        sum += field.get<double>();
+                    }
+                }
+            }
+            const auto stop = std::chrono::high_resolution_clock::now();
+            CHECK_GT(sum, 0.);
+
+            const auto test_duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
+            std::cout << "[nanojsoncpp - converted during parsing] : " << test_duration.count() << "µs" << std::endl;
+        }
+    }
+
+    TEST_CASE("Integer fields")
+    {
+        // Records made of ids, timestamps and counters, as big as allowed by json_size_t, up to 4MB
+        const size_t max_size       = std::min<size_t>(nanojsoncpp::MAX_JSON_STRING_SIZE, 4u * 1024u * 1024u) - 1024u;
+        std::string  input_json_str = "[";
+        for (int64_t i = 0; input_json_str.size() < max_size; i++)
+        {
+            if (i != 0)
+            {
+                input_json_str += ",";
+            }
+            input_json_str += "{\"id\":" + std::to_string(i) + ",\"ts\":" + std::to_string(1700000000000 + i * 997) +
+                              ",\"count\":" + std::to_string(i % 1000) + "}";
+        }
+        input_json_str += "]";
+
+        auto count = nanojsoncpp::parse_count(input_json_str);
+        REQUIRE(count);
+        std::vector<nanojsoncpp::json_value_desc> descriptors(count->descriptors);
+        std::vector<nanojsoncpp::json_number>     numbers(count->descriptors);
+
+        SUBCASE("nanojsoncpp - parse only")
+        {
+            const auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < 10; i++)
+            {
+                auto root = nanojsoncpp::parse(input_json_str, descriptors);
+                if (!root)
+                {
+                    CHECK(false);
+                }
+            }
+            const auto stop = std::chrono::high_resolution_clock::now();
+
+            const auto test_duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
+            std::cout << "[nanojsoncpp - integers parse] : " << test_duration.count() << "µs ("
+                      << get_throughput(input_json_str.size(), 10, test_duration) << " MB/s)" << std::endl;
+        }
+
+        SUBCASE("nanojsoncpp - converted during parsing")
+        {
+            int64_t    sum   = 0;
+            const auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < 10; i++)
+            {
+                auto root = nanojsoncpp::parse(input_json_str, descriptors, numbers);
+                REQUIRE(root);
+                for (const auto& record : root.value())
+                {
+                    for (const auto& field : record)
+                    {
+                        sum += field.get<int64_t>();
+                    }
+                }
+            }
+            const auto stop = std::chrono::high_resolution_clock::now();
+            CHECK_NE(sum, 0);
+
+            const auto test_duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
+            std::cout << "[nanojsoncpp - integers converted during parsing] : " << test_duration.count() << "µs ("
+                      << get_throughput(input_json_str.size(), 10, test_duration) << " MB/s)" << std::endl;
+        }
+    }
+
+    TEST_CASE("Large numeric array")
+    {
+        // Waveform samples, as big as allowed by json_size_t, up to 1MB
+        const size_t max_size       = std::min<size_t>(nanojsoncpp::MAX_JSON_STRING_SIZE, 1024u * 1024u) - 1024u;
+        std::string  input_json_str = "[";
+        for (int i = 0; input_json_str.size() < max_size; i++)
+        {
+            if (i != 0)
+            {
+                input_json_str += ",";
+            }
+            input_json_str += std::to_string((i * 7919) % 20000 - 10000) + "." + std::to_string(i % 1000);
+        }
+        input_json_str += "]";
+
+        auto count = nanojsoncpp::parse_count(input_json_str);
+        REQUIRE(count);
+        std::vector<nanojsoncpp::json_value_desc> descriptors(count->descriptors);
+        auto                                      root = nanojsoncpp::parse(input_json_str, descriptors);
+        REQUIRE(root);
+        std::vector<double> samples(root->size());
+
+        SUBCASE("nanojsoncpp - iterate and convert each element")
+        {
+            const auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < 10; i++)
+            {
+                size_t index = 0u;
+                for (const auto& value : root.value())
+                {
+                    samples[index] = value.get<double>();
+                    index++;
+                }
+            }
+            const auto stop = std::chrono::high_resolution_clock::now();
+            CHECK_EQ(samples.front(), -10000.);
+
+            const auto test_duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
+            std::cout << "[nanojsoncpp - iterate and convert] : " << test_duration.count() << "µs" << std::endl;
+        }
+
+        SUBCASE("nanojsoncpp - bulk conversion")
+        {
+            const auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < 10; i++)
+            {
+                auto result = root->get_array(std::span<double>(samples));
+                if (result.error != nanojsoncpp::json_array_error::no_error)
+                {
+                    CHECK(false);
+                }
+            }
+            const auto stop = std::chrono::high_resolution_clock::now();
+            CHECK_EQ(samples.front(), -10000.);
+
+            const auto test_duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
+            std::cout << "[nanojsoncpp - bulk conversion] : " << test_duration.count() << "µs" << std::endl;
+        }
+    }
+
+    TEST_CASE("Time series columns")
+    {
+        // Time series samples, as big as allowed by json_size_t, up to 1MB
+        const size_t max_size       = std::min<size_t>(nanojsoncpp::MAX_JSON_STRING_SIZE, 1024u * 1024u) - 1024u;
+        std::string  input_json_str = "[";
+        for (int i = 0; input_json_str.size() < max_size; i++)
+        {
+            if (i != 0)
+            {
+                input_json_str += ",";
+            }
+            input_json_str += "{\"t\":" + std::to_string(1700000000 + i) + ",\"v\":" + std::to_string((i * 7919) % 20000 - 10000) + "." +
+                              std::to_string(i % 100) + ",\"q\":" + std::to_string(i % 3) + "}";
+        }
+        input_json_str += "]";
+
+        auto count = nanojsoncpp::parse_count(input_json_str);
+        REQUIRE(count);
+        std::vector<nanojsoncpp::json_value_desc> descriptors(count->descriptors);
+        auto                                      root = nanojsoncpp::parse(input_json_str, descriptors);
+        REQUIRE(root);
+        std::vector<int64_t> t(root->size());
+        std::vector<double>  v(root->size());
+        std::vector<int>     q(root->size());
+
+        SUBCASE("nanojsoncpp - member lookups")
+        {
+            const nanojsoncpp::json_key t_key("t");
+            const nanojsoncpp::json_key v_key("v");
+            const nanojsoncpp::json_key q_key("q");
+
+            const auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < 10; i++)
+            {
+                size_t index = 0u;
+                for (const auto& sample : root.value())
+                {
+                    t[index] = sample.get(t_key)->get<int64_t>();
+                    v[index] = sample.get(v_key)->get<double>();
+                    q[index] = sample.get(q_key)->get<int>();
+                    index++;
+                }
+            }
+            const auto stop = std::chrono::high_resolution_clock::now();
+            CHECK_EQ(t.front(), 1700000000);
+
+            const auto test_duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
+            std::cout << "[nanojsoncpp - member lookups] : " << test_duration.count() << "µs" << std::endl;
+        }
+
+        SUBCASE("nanojsoncpp - columns extraction")
+        {
+            std::array<nanojsoncpp::json_column, 3u> columns = {nanojsoncpp::json_column(nanojsoncpp::json_key("t"), std::span<int64_t>(t)),
+                                                                nanojsoncpp::json_column(nanojsoncpp::json_key("v"), std::span<double>(v)),
+                                                                nanojsoncpp::json_column(nanojsoncpp::json_key("q"), std::span<int>(q))};
+
+            const auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < 10; i++)
+            {
+                auto result = root->get_columns(columns);
+                if (result.error != nanojsoncpp::json_array_error::no_error)
+                {
+                    CHECK(false);
+                }
+            }
+            const auto stop = std::chrono::high_resolution_clock::now();
+            CHECK_EQ(t.front(), 1700000000);
+
+            const auto test_duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
+            std::cout << "[nanojsoncpp - columns extraction] : " << test_duration.count() << "µs" << std::endl;
+        }
+
+        SUBCASE("nanojsoncpp - column statistics")
+        {
+            for (size_t i = 0u; i < v.size(); i++)
+            {
+                v[i] = static_cast<double>(i % 1000u);
+            }
+
+            double     sum   = 0.;
+            const auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < 100; i++)
+            {
+                auto stats = nanojsoncpp::get_stats(std::span<double>(v));
+                sum += stats->sum;
+            }
+            const auto stop = std::chrono::high_resolution_clock::now();
+            CHECK_GT(sum, 0.);
+
+            const auto test_duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
+            std::cout << "[nanojsoncpp - column statistics] : " << test_duration.count() << "µs" << std::endl;
+        }
+    }
+
+    TEST_CASE("Large single document")
+    {
+        // Array of objects as big as allowed by json_size_t, up to 64MB
+        const size_t max_size       = std::min<size_t>(nanojsoncpp::MAX_JSON_STRING_SIZE, 64u * 1024u * 1024u) - 1024u;
+        std::string  input_json_str = "[";
+        for (int i = 0; input_json_str.size() < max_size; i++)
+        {
+            if (i != 0)
+            {
+                input_json_str += ",";
+            }
+            input_json_str += "{\"id\":" + std::to_string(i) + ",\"name\":\"item " + std::to_string(i) +
+                              "\",\"values\":[1.5,-2,true,null],\"nested\":{\"a\":\"b\"}}";
+        }
+        input_json_str += "]";
+
+        auto count = nanojsoncpp::parse_count(input_json_str);
+        REQUIRE(count);
+
+        SUBCASE("nanojsoncpp - parse only")
+        {
+            std::vector<nanojsoncpp::json_value_desc> descriptors(count->descriptors);
+
+            const auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < 10; i++)
+            {
+                auto root = nanojsoncpp::parse(input_json_str, descriptors);
+                if (!root)
+                {
+                    CHECK(false);
+                }
+            }
+            const auto stop = std::chrono::high_resolution_clock::now();
+
+            const auto test_duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
+            std::cout << "[nanojsoncpp - parse] : " << test_duration.count() << "µs ("
+                      << get_throughput(input_json_str.size(), 10, test_duration) << " MB/s)" << std::endl;
+        }
+
+        SUBCASE("nanojsoncpp - parse in parallel")
+        {
+            // Margin for the parts which contain more values than the others
+            std::vector<nanojsoncpp::json_value_desc> descriptors(count->descriptors + (count->descriptors / 4u));
+
+            const size_t max_threads_count = std::max(std::thread::hardware_concurrency(), 1u);
+            for (size_t threads_count = 1u; threads_count <= max_threads_count; threads_count *= 2u)
+            {
+                const auto start = std::chrono::high_resolution_clock::now();
+                for (int i = 0; i < 10; i++)
+                {
+                    auto root = nanojsoncpp::parse_parallel(input_json_str, descriptors, threads_count);
+                    if (!root)
+                    {
+                        CHECK(false);
+                    }
+                }
+                const auto stop = std::chrono::high_resolution_clock::now();
+
+                const auto test_duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
+                std::cout << "[nanojsoncpp - parse with " << threads_count << " thread(s)] : " << test_duration.count() << "µs ("
+                          << get_throughput(input_json_str.size(), 10, test_duration) << " MB/s)" << std::endl;
+            }
+        }
+    }
+#endif // NANOJSONCPP_BUILD_PARALLEL
+
+    TEST_CASE("Newline delimited records")
+    {
+        // Log file with 1 small record per line
+        std::string input_json_str;
+        for (int i = 0; i < 10000; i++)
+        {
+            input_json_str += "{\"id\":" + std::to_string(i) + ",\"level\":\"info\",\"tags\":[\"a\",\"b\"],\"latency\":12.5}\n";
+        }
+
+        SUBCASE("nanojsoncpp - parse many")
+        {
+            std::array<nanojsoncpp::json_value_desc, 10u> descriptors;
+
+            size_t     count = 0u;
+            const auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < 100; i++)
+            {
+                for (const auto& document : nanojsoncpp::parse_many(input_json_str, descriptors))
+                {
+                    count += document.root.size();
+                }
+            }
+            const auto stop = std::chrono::high_resolution_clock::now();
+            CHECK_EQ(count, 100u * 10000u * 4u);
+
+            const auto test_duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
+            std::cout << "[nanojsoncpp - parse many] : " << test_duration.count() << "µs ("
+                      << get_throughput(input_json_str.size(), 100, test_duration) << " MB/s)" << std::endl;
+        }
+
+#ifdef NANOJSONCPP_BUILD_PARALLEL
+        SUBCASE("nanojsoncpp - parse many in parallel")
+        {
+            // Per thread counters in separate cache lines
+            struct alignas(64u) thread_counter
+            {
+                size_t count;
+            };
+            const size_t max_threads_count = std::max(std::thread::hardware_concurrency(), 1u);
+            for (size_t threads_count = 1u; threads_count <= max_threads_count; threads_count *= 2u)
+            {
+                std::vector<nanojsoncpp::json_value_desc> descriptors(threads_count * 10u);
+                std::vector<thread_counter>               counters(threads_count, thread_counter{0u});
+
+                const auto start = std::chrono::high_resolution_clock::now();
+                for (int i = 0; i < 100; i++)
+                {
+                    bool success = nanojsoncpp::parse_many_parallel(input_json_str,
+                                                                    descriptors,
+                                                                    threads_count,
+                                                                    [&counters](size_t thread_index, const nanojsoncpp::json_document& document)
+                                                                    { counters[thread_index].count += document.root.size(); });
+                    if (!success)
+                    {
+                        CHECK(false);
+                    }
+                }
+                const auto stop = std::chrono::high_resolution_clock::now();
+                size_t     count = 0u;
+                for (const auto& counter : counters)
+                {
+                    count += counter.count;
+                }
+                CHECK_EQ(count, 100u * 10000u * 4u);
+
+                const auto test_duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
+                std::cout << "[nanojsoncpp - parse many with " << threads_count << " thread(s)] : " << test_duration.count() << "µs ("
+                          << get_throughput(input_json_str.size(), 100, test_duration) << " MB/s)" << std::endl;
+            }
+        }
+#endif // NANOJSONCPP_BUILD_PARALLEL
+
+        SUBCASE("nlohmann::json - parse each line")
+        {
+            size_t     count = 0u;
+            const auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < 100; i++)
+            {
+                size_t line_start = 0u;
+                size_t line_end   = input_json_str.find('\n');
+                while (line_end != std::string::npos)
+                {
+                    auto root = nlohmann::json::parse(input_json_str.substr(line_start, line_end - line_start));
+                    count += root.size();
+                    line_start = line_end + 1u;
+                    line_end   = input_json_str.find('\n', line_start);
+                }
+            }
+            const auto stop = std::chrono::high_resolution_clock::now();
+            CHECK_EQ(count, 100u * 10000u * 4u);
+
+            const auto test_duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
+            std::cout << "[nlohmann::json] : " << test_duration.count() << "µs (" << get_throughput(input_json_str.size(), 100, test_duration)
+                      << " MB/s)" << std::endl;
         }
     }
 }
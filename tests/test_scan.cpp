@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2025 c-jimenez
+ * SPDX-License-Identifier: MIT
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include <nanojsoncpp/private/scan.h>
+#include <nanojsoncpp/private/utf8.h>
+
+#include <array>
+#include <string>
+
+TEST_SUITE("nanojsoncpp scan test suite")
+{
+    TEST_CASE("Block classification")
+    {
+        const std::array<nanojsoncpp::scan_isa, 3u> isas = {
+            nanojsoncpp::scan_isa::scalar, nanojsoncpp::scan_isa::sse2, nanojsoncpp::scan_isa::avx2};
+
+        // Known block
+        std::string block = R"({ "name": "a\"b", "array": [1, 2.5, true],	"obj":{}}    )";
+        block.resize(nanojsoncpp::SCAN_BLOCK_SIZE, '\n');
+        block[63] = '\r';
+
+        uint64_t quotes      = 0u;
+        uint64_t backslashes = 0u;
+        uint64_t structurals = 0u;
+        uint64_t blanks      = 0u;
+        for (size_t i = 0u; i < block.size(); i++)
+        {
+            const uint64_t bit = (static_cast<uint64_t>(1u) << i);
+            const char     c   = block[i];
+            if (c == '"')
+            {
+                quotes |= bit;
+            }
+            if (c == '\\')
+            {
+                backslashes |= bit;
+            }
+            if ((c == '{') || (c == '}') || (c == '[') || (c == ']') || (c == ':') || (c == ','))
+            {
+                structurals |= bit;
+            }
+            if ((c == ' ') || (c == '\t') || (c == '\r') || (c == '\n'))
+            {
+                blanks |= bit;
+            }
+        }
+
+        for (auto isa : isas)
+        {
+            auto masks = nanojsoncpp::get_scan_block_func(isa)(block.data());
+            CHECK_EQ(masks.quotes, quotes);
+            CHECK_EQ(masks.backslashes, backslashes);
+            CHECK_EQ(masks.structurals, structurals);
+            CHECK_EQ(masks.blanks, blanks);
+        }
+
+        auto masks = nanojsoncpp::scan_block(block.data());
+        CHECK_EQ(masks.quotes, quotes);
+        CHECK_EQ(masks.backslashes, backslashes);
+        CHECK_EQ(masks.structurals, structurals);
+        CHECK_EQ(masks.blanks, blanks);
+
+        // All the possible chars
+        std::array<char, 256u> all_chars;
+        for (size_t i = 0u; i < all_chars.size(); i++)
+        {
+            all_chars[i] = static_cast<char>(i);
+        }
+        for (size_t i = 0u; i < all_chars.size(); i += nanojsoncpp::SCAN_BLOCK_SIZE)
+        {
+            auto ref_masks = nanojsoncpp::get_scan_block_func(nanojsoncpp::scan_isa::scalar)(&all_chars[i]);
+            for (auto isa : isas)
+            {
+                auto isa_masks = nanojsoncpp::get_scan_block_func(isa)(&all_chars[i]);
+                CHECK_EQ(isa_masks.quotes, ref_masks.quotes);
+                CHECK_EQ(isa_masks.backslashes, ref_masks.backslashes);
+                CHECK_EQ(isa_masks.structurals, ref_masks.structurals);
+                CHECK_EQ(isa_masks.blanks, ref_masks.blanks);
+            }
+        }
+    }
+
+    TEST_CASE("String chars search")
+    {
+        std::string json_string(200u, 'a');
+        json_string[10u]  = '"';
+        json_string[100u] = '\\';
+        json_string[199u] = '"';
+
+        const char* begin = json_string.data();
+        const char* end   = begin + json_string.size();
+
+        CHECK_EQ(nanojsoncpp::find_string_char(begin, end), begin + 10u);
+        CHECK_EQ(nanojsoncpp::find_string_char(begin + 11u, end), begin + 100u);
+        CHECK_EQ(nanojsoncpp::find_string_char(begin + 101u, end), begin + 199u);
+        CHECK_EQ(nanojsoncpp::find_string_char(end, end), end);
+
+        // Not found before the end of the string
+        CHECK_EQ(nanojsoncpp::find_string_char(begin + 101u, begin + 130u), begin + 130u);
+        CHECK_EQ(nanojsoncpp::find_string_char(begin + 11u, begin + 14u), begin + 14u);
+    }
+
+    TEST_CASE("Non ASCII chars")
+    {
+        std::string json_string(100u, 'a');
+        json_string[40u] = '\xC3';
+        json_string[41u] = '\xA9';
+        json_string[60u] = '"';
+        json_string[70u] = '\xE9';
+        json_string[90u] = '\\';
+
+        const char* begin = json_string.data();
+        const char* end   = begin + json_string.size();
+
+        // Only the non ASCII chars preceding the found char are reported
+        bool ascii = true;
+        CHECK_EQ(nanojsoncpp::find_string_char(begin, end, ascii), begin + 60u);
+        CHECK_FALSE(ascii);
+        ascii = true;
+        CHECK_EQ(nanojsoncpp::find_string_char(begin + 42u, end, ascii), begin + 60u);
+        CHECK(ascii);
+        CHECK_EQ(nanojsoncpp::find_string_char(begin + 61u, end, ascii), begin + 90u);
+        CHECK_FALSE(ascii);
+        ascii = true;
+        CHECK_EQ(nanojsoncpp::find_string_char(begin + 91u, end, ascii), end);
+        CHECK(ascii);
+
+        // ASCII chars
+        CHECK_EQ(nanojsoncpp::skip_ascii_chars(begin, end), begin + 40u);
+        CHECK_EQ(nanojsoncpp::skip_ascii_chars(begin + 71u, end), end);
+        CHECK_EQ(nanojsoncpp::skip_ascii_chars(begin + 95u, end), end);
+
+        // UTF-8 sequences
+        CHECK_EQ(nanojsoncpp::find_invalid_utf8(begin, begin + 60u, ascii), begin + 60u);
+        CHECK_FALSE(ascii);
+        CHECK_EQ(nanojsoncpp::find_invalid_utf8(begin + 42u, begin + 60u, ascii), begin + 60u);
+        CHECK(ascii);
+        CHECK_EQ(nanojsoncpp::find_invalid_utf8(begin, end, ascii), begin + 70u);
+        CHECK_EQ(nanojsoncpp::find_invalid_utf8(begin, begin + 41u, ascii), begin + 40u);
+        const std::string_view emoji("\xF0\x9F\x98\x80");
+        CHECK_EQ(nanojsoncpp::get_utf8_sequence_size(emoji.data(), emoji.data() + emoji.size()), 4u);
+        CHECK_EQ(nanojsoncpp::get_utf8_sequence_size(emoji.data(), emoji.data() + 3u), 0u);
+    }
+}
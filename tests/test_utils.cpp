@@ -6,9 +6,11 @@
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include <doctest.h>
 
+#include <nanojsoncpp/private/digits.h>
 #include <nanojsoncpp/private/utils.h>
 
 #include <limits>
+#include <string>
 
 using namespace std::string_view_literals;
 
@@ -35,6 +37,55 @@ TEST_SUITE("nanojsoncpp utilities test suite")
                  std::numeric_limits<nanojsoncpp::json_int_t>::max());
         CHECK_EQ(nanojsoncpp::to_int(std::to_string(std::numeric_limits<nanojsoncpp::json_int_t>::min())),
                  std::numeric_limits<nanojsoncpp::json_int_t>::min());
+
+        // Values using the 8 digits conversion
+        CHECK_EQ(nanojsoncpp::to_int("12345678"), 12345678);
+        CHECK_EQ(nanojsoncpp::to_int("-00000001"), -1);
+        CHECK_EQ(nanojsoncpp::to_int("123456789"), 123456789);
+#ifndef NANOJSONCPP_USE_CPP17_FROM_CHARS_TO_CHARS
+        CHECK_EQ(nanojsoncpp::to_int("1234567:"), 0);
+        CHECK_EQ(nanojsoncpp::to_int("12345678/"), 0);
+#endif
+    }
+
+    TEST_CASE("parse_digits()")
+    {
+        // All the lengths around the 8 digits conversion
+        std::string digits;
+        uint64_t    expected = 0u;
+        for (size_t i = 0u; i < 20u; i++)
+        {
+            const char c = static_cast<char>('0' + ((i * 7u + 3u) % 10u));
+            digits += c;
+            expected = expected * 10u + static_cast<uint64_t>(c - '0');
+
+            const std::string str   = digits + ",";
+            uint64_t          value = 0u;
+            CHECK_EQ(nanojsoncpp::parse_digits(str.data(), str.data() + str.size(), value), str.data() + digits.size());
+            CHECK_EQ(value, expected);
+        }
+
+        // Chars surrounding the digits in the ASCII table stop the conversion at any position of a 8 chars word
+        for (size_t i = 0u; i < 8u; i++)
+        {
+            for (char c : {'/', ':', '\x00', '\xB0', 'p', ' '})
+            {
+                std::string str   = "99999999";
+                uint64_t    value = 0u;
+                str[i]            = c;
+                CHECK_EQ(nanojsoncpp::parse_digits(str.data(), str.data() + str.size(), value), str.data() + i);
+                CHECK_EQ(value, static_cast<uint64_t>(nanojsoncpp::to_int(str.substr(0u, i))));
+            }
+        }
+
+        // The value keeps accumulating from its initial value and the end of the chars is respected
+        const std::string str   = "1234567890123456";
+        uint64_t          value = 7u;
+        CHECK_EQ(nanojsoncpp::parse_digits(str.data(), str.data() + 12u, value), str.data() + 12u);
+        CHECK_EQ(value, 7123456789012u);
+        CHECK_EQ(nanojsoncpp::parse_eight_digits(nanojsoncpp::load_eight_chars("98765432")), 98765432u);
+        CHECK(nanojsoncpp::is_eight_digits(nanojsoncpp::load_eight_chars("00000000")));
+        CHECK_FALSE(nanojsoncpp::is_eight_digits(nanojsoncpp::load_eight_chars("0000000a")));
     }
 
     TEST_CASE("to_float()")
@@ -43,6 +94,11 @@ TEST_SUITE("nanojsoncpp utilities test suite")
         CHECK_EQ(nanojsoncpp::to_float(""), 0.);
         CHECK_EQ(nanojsoncpp::to_float("-"), 0.);
         CHECK_EQ(nanojsoncpp::to_float("."), 0.);
+#ifndef NANOJSONCPP_USE_CPP17_FROM_CHARS_TO_CHARS
+        CHECK_EQ(nanojsoncpp::to_float("1e"), 0.);
+        CHECK_EQ(nanojsoncpp::to_float("1e+"), 0.);
+        CHECK_EQ(nanojsoncpp::to_float("1.5e3x"), 0.);
+#endif
 
         // Valid values
         CHECK_EQ(nanojsoncpp::to_float("0"), 0.);
@@ -51,6 +107,39 @@ TEST_SUITE("nanojsoncpp utilities test suite")
         CHECK_EQ(nanojsoncpp::to_float("-123."), -123.);
         CHECK_EQ(nanojsoncpp::to_float("1234567890.54321"), static_cast<nanojsoncpp::json_float_t>(1234567890.54321));
         CHECK_EQ(nanojsoncpp::to_float("-1234567890.54321"), static_cast<nanojsoncpp::json_float_t>(-1234567890.54321));
+        CHECK_EQ(nanojsoncpp::to_float("0.1"), static_cast<nanojsoncpp::json_float_t>(0.1));
+
+        // Exponent values
+        CHECK_EQ(nanojsoncpp::to_float("1e5"), static_cast<nanojsoncpp::json_float_t>(1e5));
+        CHECK_EQ(nanojsoncpp::to_float("-2.5E-3"), static_cast<nanojsoncpp::json_float_t>(-2.5E-3));
+        CHECK_EQ(nanojsoncpp::to_float("6.02214076e+23"), static_cast<nanojsoncpp::json_float_t>(6.02214076e+23));
+        CHECK_EQ(nanojsoncpp::to_float("1e-7"), static_cast<nanojsoncpp::json_float_t>(1e-7));
+        CHECK_EQ(nanojsoncpp::to_float("0e0"), 0.);
+
+        // Correct rounding of values needing more than a single floating point operation
+        CHECK_EQ(nanojsoncpp::to_float("9007199254740993"), static_cast<nanojsoncpp::json_float_t>(9007199254740992.));
+        CHECK_EQ(nanojsoncpp::to_float("123456789012345678901234567890"), static_cast<nanojsoncpp::json_float_t>(123456789012345678901234567890.));
+        CHECK_EQ(nanojsoncpp::to_float("0.000000000000000000000000000000000000000000001e45"), 1.);
+        if constexpr (std::is_same_v<nanojsoncpp::json_float_t, double>)
+        {
+            CHECK_EQ(nanojsoncpp::to_float("1.7976931348623157e308"), 1.7976931348623157e308);
+            CHECK_EQ(nanojsoncpp::to_float("2.2250738585072011e-308"), 2.2250738585072011e-308);
+            CHECK_EQ(nanojsoncpp::to_float("4.9406564584124654e-324"), 4.9406564584124654e-324);
+
+            // Values close to the halfway point between 1 and the next double (1 + 2^-53), decided by their last digit
+            CHECK_EQ(nanojsoncpp::to_float("1.00000000000000011102230246251565404236316680908203126"), 1.0000000000000002);
+            CHECK_EQ(nanojsoncpp::to_float("1.00000000000000011102230246251565404236316680908203125"), 1.);
+            CHECK_EQ(nanojsoncpp::to_float("1.00000000000000011102230246251565404236316680908203124"), 1.);
+            const std::string long_above = "1.00000000000000011102230246251565404236316680908203125" + std::string(800u, '0') + "1";
+            CHECK_EQ(nanojsoncpp::to_float(long_above), 1.0000000000000002);
+        }
+        else
+        {
+            // Values close to the halfway point between 1 and the next float (1 + 2^-24), decided by their last digit
+            const std::string long_above = "1.000000059604644775390625" + std::string(200u, '0') + "1";
+            CHECK_EQ(nanojsoncpp::to_float(long_above), 1.00000012f);
+            CHECK_EQ(nanojsoncpp::to_float("1.000000059604644775390625"), 1.f);
+        }
     }
 
     TEST_CASE("to_string(json_int_t)")
@@ -87,4 +176,15 @@ TEST_SUITE("nanojsoncpp utilities test suite")
         s = nanojsoncpp::to_string(min, tmp5);
         CHECK_EQ(s, 0);
     }
+
+    TEST_CASE("hash_name()")
+    {
+        // Reference values of the 32 bits FNV-1a hash
+        CHECK_EQ(nanojsoncpp::hash_name(""sv), 0x811C9DC5u);
+        CHECK_EQ(nanojsoncpp::hash_name("a"sv), 0xE40C292Cu);
+        CHECK_EQ(nanojsoncpp::hash_name("foobar"sv), 0xBF9CF968u);
+
+        // Compile time computation
+        static_assert(nanojsoncpp::hash_name("foobar"sv) == 0xBF9CF968u);
+    }
 }